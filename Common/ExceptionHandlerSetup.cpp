@@ -20,6 +20,7 @@
 #include "Common/ExceptionHandlerSetup.h"
 
 static BadAccessHandler g_badAccessHandler;
+static SingleStepHandler g_singleStepHandler;
 static void *altStack = nullptr;
 
 #ifdef MACHINE_CONTEXT_SUPPORTED
@@ -28,6 +29,7 @@ static void *altStack = nullptr;
 #if PPSSPP_PLATFORM(WINDOWS) && !PPSSPP_PLATFORM(UWP)
 
 static PVOID g_vectoredExceptionHandle;
+static bool g_singleStepEnabled = false;
 
 static LONG NTAPI GlobalExceptionHandler(PEXCEPTION_POINTERS pPtrs) {
 	switch (pPtrs->ExceptionRecord->ExceptionCode) {
@@ -70,19 +72,27 @@ static LONG NTAPI GlobalExceptionHandler(PEXCEPTION_POINTERS pPtrs) {
 		// might want to do something fun with this one day?
 		return EXCEPTION_CONTINUE_SEARCH;
 
+	case EXCEPTION_SINGLE_STEP:
+		if (g_singleStepEnabled && g_singleStepHandler && g_singleStepHandler(pPtrs->ContextRecord)) {
+			return (DWORD)EXCEPTION_CONTINUE_EXECUTION;
+		}
+		return EXCEPTION_CONTINUE_SEARCH;
+
 	default:
 		return EXCEPTION_CONTINUE_SEARCH;
 	}
 }
 
-void InstallExceptionHandler(BadAccessHandler badAccessHandler) {
+void InstallExceptionHandler(BadAccessHandler badAccessHandler, SingleStepHandler stepHandler) {
 	if (g_vectoredExceptionHandle) {
 		g_badAccessHandler = badAccessHandler;
+		g_singleStepHandler = stepHandler;
 		return;
 	}
 
 	INFO_LOG(Log::System, "Installing exception handler");
 	g_badAccessHandler = badAccessHandler;
+	g_singleStepHandler = stepHandler;
 #ifdef USE_ASAN
 	g_vectoredExceptionHandle = AddVectoredExceptionHandler(FALSE, GlobalExceptionHandler);
 #else
@@ -97,6 +107,15 @@ void UninstallExceptionHandler() {
 		g_vectoredExceptionHandle = nullptr;
 	}
 	g_badAccessHandler = nullptr;
+	g_singleStepHandler = nullptr;
+	g_singleStepEnabled = false;
+}
+
+bool EnableSingleStepHandler(bool enable) {
+	if (enable && !g_singleStepHandler)
+		return false;
+	g_singleStepEnabled = enable;
+	return true;
 }
 
 #elif defined(__APPLE__)
@@ -182,7 +201,8 @@ static void ExceptionThread(mach_port_t port) {
 	}
 }
 
-void InstallExceptionHandler(BadAccessHandler badAccessHandler) {
+void InstallExceptionHandler(BadAccessHandler badAccessHandler, SingleStepHandler stepHandler) {
+	// Single stepping isn't hooked up for the Mach exception port yet.
 	if (g_badAccessHandler) {
 		// The rest of the setup we don't need to do again.
 		g_badAccessHandler = badAccessHandler;
@@ -216,12 +236,18 @@ void InstallExceptionHandler(BadAccessHandler badAccessHandler) {
 void UninstallExceptionHandler() {
 }
 
+bool EnableSingleStepHandler(bool enable) {
+	return !enable;
+}
+
 #else
 
 #include <signal.h>
 
 static struct sigaction old_sa_segv;
 static struct sigaction old_sa_bus;
+static struct sigaction old_sa_trap;
+static bool g_singleStepEnabled = false;
 
 static void sigsegv_handler(int sig, siginfo_t* info, void* raw_context) {
 	if (sig != SIGSEGV && sig != SIGBUS) {
@@ -280,12 +306,40 @@ static void sigsegv_handler(int sig, siginfo_t* info, void* raw_context) {
 	}
 }
 
-void InstallExceptionHandler(BadAccessHandler badAccessHandler) {
+static void sigtrap_handler(int sig, siginfo_t *info, void *raw_context) {
+	ucontext_t *context = (ucontext_t *)raw_context;
+#ifdef __OpenBSD__
+	ucontext_t *ctx = context;
+#else
+	mcontext_t *ctx = &context->uc_mcontext;
+#endif
+	// Only single step traps, leave breakpoints (int3) alone.
+	if (info->si_code == TRAP_TRACE && g_singleStepHandler && g_singleStepHandler(ctx)) {
+		return;
+	}
+
+	if (old_sa_trap.sa_flags & SA_SIGINFO) {
+		old_sa_trap.sa_sigaction(sig, info, raw_context);
+		return;
+	}
+	if (old_sa_trap.sa_handler == SIG_DFL) {
+		signal(sig, SIG_DFL);
+		raise(sig);
+		return;
+	}
+	if (old_sa_trap.sa_handler == SIG_IGN) {
+		return;
+	}
+	old_sa_trap.sa_handler(sig);
+}
+
+void InstallExceptionHandler(BadAccessHandler badAccessHandler, SingleStepHandler stepHandler) {
 	if (!badAccessHandler) {
 		return;
 	}
 	if (g_badAccessHandler) {
 		g_badAccessHandler = badAccessHandler;
+		g_singleStepHandler = stepHandler;
 		return;
 	}
 	
@@ -318,6 +372,27 @@ void InstallExceptionHandler(BadAccessHandler badAccessHandler) {
 #ifdef __APPLE__
 	sigaction(SIGBUS, &sa, &old_sa_bus);
 #endif
+
+	// SIGTRAP is only hooked while needed, see EnableSingleStepHandler().
+	g_singleStepHandler = stepHandler;
+}
+
+bool EnableSingleStepHandler(bool enable) {
+	if (enable == g_singleStepEnabled)
+		return true;
+	if (enable) {
+		if (!g_singleStepHandler)
+			return false;
+		struct sigaction sa_trap{};
+		sa_trap.sa_sigaction = &sigtrap_handler;
+		sa_trap.sa_flags = SA_SIGINFO | SA_ONSTACK;
+		sigemptyset(&sa_trap.sa_mask);
+		sigaction(SIGTRAP, &sa_trap, &old_sa_trap);
+	} else {
+		sigaction(SIGTRAP, &old_sa_trap, nullptr);
+	}
+	g_singleStepEnabled = enable;
+	return true;
 }
 
 void UninstallExceptionHandler() {
@@ -337,17 +412,22 @@ void UninstallExceptionHandler() {
 #ifdef __APPLE__
 	sigaction(SIGBUS, &old_sa_bus, nullptr);
 #endif
+	EnableSingleStepHandler(false);
 	INFO_LOG(Log::System, "Uninstalled exception handler");
 	g_badAccessHandler = nullptr;
+	g_singleStepHandler = nullptr;
 }
 
 #endif
 
 #else  // !MACHINE_CONTEXT_SUPPORTED
 
-void InstallExceptionHandler(BadAccessHandler badAccessHandler) {
+void InstallExceptionHandler(BadAccessHandler badAccessHandler, SingleStepHandler stepHandler) {
 	ERROR_LOG(Log::System, "Exception handler not implemented on this platform, can't install");
 }
 void UninstallExceptionHandler() { }
+bool EnableSingleStepHandler(bool enable) {
+	return !enable;
+}
 
 #endif  // MACHINE_CONTEXT_SUPPORTED
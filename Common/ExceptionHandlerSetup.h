@@ -12,8 +12,14 @@
 // On OpenBSD, context is a ucontext_t.
 // Ugh, might need to abstract this better.
 typedef bool (*BadAccessHandler)(uintptr_t address, void *context);
+// Called after a single step trap (x86 trap flag), with the same context type as above.
+typedef bool (*SingleStepHandler)(void *context);
 
-void InstallExceptionHandler(BadAccessHandler accessHandler);
+void InstallExceptionHandler(BadAccessHandler accessHandler, SingleStepHandler stepHandler = nullptr);
+
+// Single step traps only reach the stepHandler while this is enabled. Returns false if that's not possible.
+// On POSIX, SIGTRAP is only hooked while enabled, so the rest of the time traps go where they did before.
+bool EnableSingleStepHandler(bool enable);
 
 // Implementation note: This must be a no-op if InstallExceptionHandler hasn't been called.
 void UninstallExceptionHandler();
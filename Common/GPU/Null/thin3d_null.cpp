@@ -0,0 +1,350 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+// A DrawContext that keeps buffers and textures in memory but never rasterizes anything.
+// This lets the GPU backends' CPU side (vertex decoding, texture decoding, state mapping) run
+// on machines without a GPU, so it can be benchmarked and profiled in isolation.
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Common/GPU/thin3d.h"
+#include "Common/GPU/thin3d_create.h"
+#include "Common/Log.h"
+#include "Common/TimeUtil.h"
+
+namespace Draw {
+
+class NullBuffer : public Buffer {
+public:
+	explicit NullBuffer(size_t size) : data(size) {}
+	std::vector<uint8_t> data;
+};
+
+class NullTexture : public Texture {
+public:
+	explicit NullTexture(const TextureDesc &desc) {
+		width_ = desc.width;
+		height_ = desc.height;
+		depth_ = desc.depth;
+		format_ = desc.format;
+		levels.resize(std::max(desc.mipLevels, 1));
+	}
+
+	void SetLevel(int level, const uint8_t *data, TextureCallback initDataCallback);
+
+	std::vector<std::vector<uint8_t>> levels;
+};
+
+void NullTexture::SetLevel(int level, const uint8_t *data, TextureCallback initDataCallback) {
+	if (level >= (int)levels.size())
+		levels.resize(level + 1);
+
+	int w = std::max(width_ >> level, 1);
+	int h = std::max(height_ >> level, 1);
+	int d = std::max(depth_ >> level, 1);
+	int blockSize = 0;
+	size_t byteStride;
+	size_t rows;
+	if (DataFormatIsBlockCompressed(format_, &blockSize)) {
+		byteStride = (size_t)((w + 3) / 4) * blockSize;
+		rows = (h + 3) / 4;
+	} else {
+		byteStride = (size_t)w * DataFormatSizeInBytes(format_);
+		rows = h;
+	}
+
+	std::vector<uint8_t> &dest = levels[level];
+	dest.resize(byteStride * rows * d);
+	if (!initDataCallback || !initDataCallback(dest.data(), data, w, h, d, (uint32_t)byteStride, (uint32_t)(byteStride * rows))) {
+		if (data)
+			memcpy(dest.data(), data, dest.size());
+	}
+}
+
+class NullFramebuffer : public Framebuffer {
+public:
+	explicit NullFramebuffer(const FramebufferDesc &desc) {
+		width_ = desc.width;
+		height_ = desc.height;
+		layers_ = desc.numLayers;
+		multiSampleLevel_ = desc.multiSampleLevel;
+		tag_ = desc.tag ? desc.tag : "";
+	}
+
+	void UpdateTag(const char *tag) override { tag_ = tag; }
+	const char *Tag() const override { return tag_.c_str(); }
+
+private:
+	std::string tag_;
+};
+
+class NullShaderModule : public ShaderModule {
+public:
+	explicit NullShaderModule(ShaderStage stage) : stage_(stage) {}
+	ShaderStage GetStage() const override { return stage_; }
+
+private:
+	ShaderStage stage_;
+};
+
+class NullDrawContext : public DrawContext {
+public:
+	NullDrawContext();
+	~NullDrawContext();
+
+	const DeviceCaps &GetDeviceCaps() const override {
+		return caps_;
+	}
+	uint32_t GetSupportedShaderLanguages() const override {
+		// Shaders are still generated, just never compiled.
+		return (uint32_t)(ShaderLanguage::GLSL_3xx | ShaderLanguage::GLSL_1xx);
+	}
+	uint32_t GetDataFormatSupport(DataFormat fmt) const override;
+
+	DepthStencilState *CreateDepthStencilState(const DepthStencilStateDesc &desc) override { return new DepthStencilState(); }
+	BlendState *CreateBlendState(const BlendStateDesc &desc) override { return new BlendState(); }
+	SamplerState *CreateSamplerState(const SamplerStateDesc &desc) override { return new SamplerState(); }
+	RasterState *CreateRasterState(const RasterStateDesc &desc) override { return new RasterState(); }
+	InputLayout *CreateInputLayout(const InputLayoutDesc &desc) override { return new InputLayout(); }
+	ShaderModule *CreateShaderModule(ShaderStage stage, ShaderLanguage language, const uint8_t *data, size_t dataSize, const char *tag) override {
+		return new NullShaderModule(stage);
+	}
+	Pipeline *CreateGraphicsPipeline(const PipelineDesc &desc, const char *tag) override { return new Pipeline(); }
+
+	Buffer *CreateBuffer(size_t size, uint32_t usageFlags) override { return new NullBuffer(size); }
+	Texture *CreateTexture(const TextureDesc &desc) override;
+	Framebuffer *CreateFramebuffer(const FramebufferDesc &desc) override { return new NullFramebuffer(desc); }
+
+	void UpdateBuffer(Buffer *buffer, const uint8_t *data, size_t offset, size_t size, UpdateBufferFlags flags) override;
+	void UpdateTextureLevels(Texture *texture, const uint8_t **data, TextureCallback initDataCallback, int numLevels) override;
+
+	void CopyFramebufferImage(Framebuffer *src, int level, int x, int y, int z, Framebuffer *dst, int dstLevel, int dstX, int dstY, int dstZ, int width, int height, int depth, Aspect aspects, const char *tag) override {}
+	bool BlitFramebuffer(Framebuffer *src, int srcX1, int srcY1, int srcX2, int srcY2, Framebuffer *dst, int dstX1, int dstY1, int dstX2, int dstY2, Aspect aspects, FBBlitFilter filter, const char *tag) override {
+		return true;
+	}
+	bool CopyFramebufferToMemory(Framebuffer *src, Aspect aspect, int x, int y, int w, int h, Draw::DataFormat format, void *pixels, int pixelStride, ReadbackMode mode, const char *tag) override;
+
+	void BindFramebufferAsRenderTarget(Framebuffer *fbo, const RenderPassInfo &rp, const char *tag) override;
+	void BindFramebufferAsTexture(Framebuffer *fbo, int binding, Aspect aspect, int layer) override {}
+	void GetFramebufferDimensions(Framebuffer *fbo, int *w, int *h) override;
+
+	void SetScissorRect(int left, int top, int width, int height) override {}
+	void SetViewport(const Viewport &viewport) override {}
+	void SetBlendFactor(float color[4]) override {}
+	void SetStencilParams(uint8_t refValue, uint8_t writeMask, uint8_t compareMask) override {}
+
+	void BindSamplerStates(int start, int count, SamplerState **state) override {}
+	void BindTextures(int start, int count, Texture **textures, TextureBindFlags flags) override {}
+	void BindVertexBuffer(Buffer *vertexBuffer, int offset) override {}
+	void BindIndexBuffer(Buffer *indexBuffer, int offset) override {}
+	void BindNativeTexture(int sampler, void *nativeTexture) override {}
+	void UpdateDynamicUniformBuffer(const void *ub, size_t size) override {}
+	void Invalidate(InvalidationFlags flags) override {}
+	void BindPipeline(Pipeline *pipeline) override {}
+
+	void Draw(int vertexCount, int offset) override {}
+	void DrawIndexed(int vertexCount, int offset) override {}
+	void DrawUP(const void *vdata, int vertexCount) override {}
+	void DrawIndexedUP(const void *vdata, int vertexCount, const void *idata, int indexCount) override {}
+	void DrawIndexedClippedBatchUP(const void *vdata, int vertexCount, const void *idata, int indexCount, Slice<ClippedDraw> draws, const void *dynUniforms, size_t size) override {}
+
+	void BeginFrame(DebugFlags debugFlags) override;
+	void EndFrame() override;
+	void Present(PresentMode presentMode, int vblanks) override;
+
+	void Clear(Aspect aspects, uint32_t colorval, float depthVal, int stencilVal) override {}
+
+	std::string GetInfoString(InfoField info) const override {
+		switch (info) {
+		case InfoField::APINAME: return "Null";
+		case InfoField::APIVERSION: return "-";
+		case InfoField::VENDORSTRING: return "Null";
+		case InfoField::VENDOR: return "";
+		case InfoField::DRIVER: return "-";
+		case InfoField::SHADELANGVERSION: return "GLSL 3.00 (not compiled)";
+		default: return "?";
+		}
+	}
+	uint64_t GetNativeObject(NativeObject obj, void *srcObject) override { return 0; }
+	void HandleEvent(Event ev, int width, int height, void *param1, void *param2) override {}
+
+	void SetInvalidationCallback(InvalidationCallback callback) override {
+		invalidationCallback_ = callback;
+	}
+
+	int GetFrameCount() override { return frameCount_; }
+
+private:
+	DeviceCaps caps_{};
+	InvalidationCallback invalidationCallback_;
+	int frameCount_ = FRAME_TIME_HISTORY_LENGTH;
+};
+
+NullDrawContext::NullDrawContext() {
+	caps_.vendor = GPUVendor::VENDOR_UNKNOWN;
+	caps_.deviceName = "Null";
+	caps_.coordConvention = CoordConvention::Direct3D11;
+	caps_.preferredDepthBufferFormat = DataFormat::D24_S8;
+	caps_.preferredShadowMapFormatLow = DataFormat::D16;
+	caps_.preferredShadowMapFormatHigh = DataFormat::D32F;
+	// Claim what most desktop GPUs can do, so the common paths are the ones exercised.
+	caps_.anisoSupported = true;
+	caps_.dualSourceBlend = true;
+	caps_.depthClampSupported = true;
+	caps_.clipDistanceSupported = true;
+	caps_.cullDistanceSupported = true;
+	caps_.framebufferCopySupported = true;
+	caps_.framebufferBlitSupported = true;
+	caps_.framebufferDepthCopySupported = true;
+	caps_.framebufferSeparateDepthCopySupported = true;
+	caps_.framebufferDepthBlitSupported = true;
+	caps_.framebufferStencilBlitSupported = true;
+	caps_.texture3DSupported = true;
+	caps_.fragmentShaderInt32Supported = true;
+	caps_.textureNPOTFullySupported = true;
+	caps_.fragmentShaderDepthWriteSupported = true;
+	caps_.fragmentShaderStencilWriteSupported = true;
+	caps_.textureDepthSupported = true;
+	caps_.blendMinMaxSupported = true;
+	caps_.provokingVertexLast = false;
+	caps_.supportsD3D9 = false;
+	caps_.presentMaxInterval = 1;
+	caps_.presentInstantModeChange = true;
+	caps_.presentModesSupported = PresentMode::FIFO | PresentMode::IMMEDIATE;
+	caps_.multiSampleLevelsMask = 1;
+
+	targetWidth_ = 480;
+	targetHeight_ = 272;
+
+	shaderLanguageDesc_.Init(GLSL_3xx);
+	CreatePresets();
+}
+
+NullDrawContext::~NullDrawContext() {
+	DestroyPresets();
+}
+
+uint32_t NullDrawContext::GetDataFormatSupport(DataFormat fmt) const {
+	switch (fmt) {
+	case DataFormat::R8G8B8A8_UNORM:
+	case DataFormat::B8G8R8A8_UNORM:
+		return FMT_RENDERTARGET | FMT_TEXTURE | FMT_INPUTLAYOUT | FMT_BLIT | FMT_STORAGE_IMAGE;
+
+	case DataFormat::R4G4B4A4_UNORM_PACK16:
+	case DataFormat::A4R4G4B4_UNORM_PACK16:
+	case DataFormat::R5G6B5_UNORM_PACK16:
+	case DataFormat::B5G6R5_UNORM_PACK16:
+	case DataFormat::R5G5B5A1_UNORM_PACK16:
+	case DataFormat::A1R5G5B5_UNORM_PACK16:
+	case DataFormat::R8_UNORM:
+	case DataFormat::R16_UNORM:
+	case DataFormat::R16_FLOAT:
+	case DataFormat::R32_FLOAT:
+		return FMT_RENDERTARGET | FMT_TEXTURE;
+
+	case DataFormat::R32G32_FLOAT:
+	case DataFormat::R32G32B32_FLOAT:
+	case DataFormat::R32G32B32A32_FLOAT:
+		return FMT_INPUTLAYOUT | FMT_TEXTURE;
+
+	case DataFormat::D16:
+	case DataFormat::D24_S8:
+	case DataFormat::D32F:
+	case DataFormat::D32F_S8:
+		return FMT_DEPTHSTENCIL | FMT_TEXTURE;
+
+	case DataFormat::BC1_RGBA_UNORM_BLOCK:
+	case DataFormat::BC2_UNORM_BLOCK:
+	case DataFormat::BC3_UNORM_BLOCK:
+	case DataFormat::BC4_UNORM_BLOCK:
+	case DataFormat::BC5_UNORM_BLOCK:
+	case DataFormat::BC7_UNORM_BLOCK:
+		return FMT_TEXTURE;
+
+	default:
+		return 0;
+	}
+}
+
+Texture *NullDrawContext::CreateTexture(const TextureDesc &desc) {
+	NullTexture *tex = new NullTexture(desc);
+	for (size_t i = 0; i < desc.initData.size(); ++i)
+		tex->SetLevel((int)i, desc.initData[i], desc.initDataCallback);
+	return tex;
+}
+
+void NullDrawContext::UpdateBuffer(Buffer *buffer, const uint8_t *data, size_t offset, size_t size, UpdateBufferFlags flags) {
+	NullBuffer *buf = (NullBuffer *)buffer;
+	_dbg_assert_(offset + size <= buf->data.size());
+	if (offset + size <= buf->data.size())
+		memcpy(buf->data.data() + offset, data, size);
+}
+
+void NullDrawContext::UpdateTextureLevels(Texture *texture, const uint8_t **data, TextureCallback initDataCallback, int numLevels) {
+	NullTexture *tex = (NullTexture *)texture;
+	for (int i = 0; i < numLevels; ++i)
+		tex->SetLevel(i, data[i], initDataCallback);
+}
+
+bool NullDrawContext::CopyFramebufferToMemory(Framebuffer *src, Aspect aspect, int x, int y, int w, int h, Draw::DataFormat format, void *pixels, int pixelStride, ReadbackMode mode, const char *tag) {
+	// Nothing was ever drawn, so read back zeros rather than leaving garbage in the destination.
+	size_t bpp = DataFormatSizeInBytes(format);
+	uint8_t *dest = (uint8_t *)pixels;
+	for (int row = 0; row < h; ++row)
+		memset(dest + (size_t)row * pixelStride * bpp, 0, (size_t)w * bpp);
+	return true;
+}
+
+void NullDrawContext::BindFramebufferAsRenderTarget(Framebuffer *fbo, const RenderPassInfo &rp, const char *tag) {
+	if (invalidationCallback_) {
+		invalidationCallback_(InvalidationCallbackFlags::RENDER_PASS_STATE);
+	}
+}
+
+void NullDrawContext::GetFramebufferDimensions(Framebuffer *fbo, int *w, int *h) {
+	if (fbo) {
+		*w = fbo->Width();
+		*h = fbo->Height();
+	} else {
+		*w = targetWidth_;
+		*h = targetHeight_;
+	}
+}
+
+void NullDrawContext::BeginFrame(DebugFlags debugFlags) {
+	FrameTimeData &frameTimeData = frameTimeHistory_.Add(frameCount_);
+	frameTimeData.afterFenceWait = time_now_d();
+	frameTimeData.frameBegin = frameTimeData.afterFenceWait;
+}
+
+void NullDrawContext::EndFrame() {
+	frameTimeHistory_[frameCount_].firstSubmit = time_now_d();
+}
+
+void NullDrawContext::Present(PresentMode presentMode, int vblanks) {
+	frameTimeHistory_[frameCount_].queuePresent = time_now_d();
+	frameCount_++;
+}
+
+DrawContext *T3DCreateNullContext() {
+	return new NullDrawContext();
+}
+
+}  // namespace Draw
@@ -34,4 +34,7 @@ DrawContext *T3DCreateD3D11Context(Microsoft::WRL::ComPtr<ID3D11Device> device,
 
 DrawContext *T3DCreateVulkanContext(VulkanContext *context, bool useRenderThread);
 
+// Accepts everything but never draws, for measuring the CPU side of the GPU backends.
+DrawContext *T3DCreateNullContext();
+
 }  // namespace Draw
@@ -38,6 +38,7 @@ typedef CONTEXT SContext;
 #define CTX_R14 R14
 #define CTX_R15 R15
 #define CTX_RIP Rip
+#define CTX_FLAGS EFlags
 
 #elif PPSSPP_ARCH(X86)
 
@@ -133,6 +134,7 @@ typedef mcontext_t SContext;
 #define CTX_R14 gregs[REG_R14]
 #define CTX_R15 gregs[REG_R15]
 #define CTX_RIP gregs[REG_RIP]
+#define CTX_FLAGS gregs[REG_EFL]
 
 #elif PPSSPP_ARCH(X86)
 
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 
 #include "Common/Math/Statistics.h"
 
@@ -9,3 +11,32 @@ void SimpleStat::Format(char *buffer, size_t sz) {
 		snprintf(buffer, sz, "%s: %0.2f (%0.2f..%0.2f, avg %0.2f)\n", name_, value_, min_, max_, smoothed_);
 	}
 }
+
+void DurationHistogram::Add(double seconds) {
+	seconds = std::max(seconds, 0.0);
+	int bucket = std::min((int)(seconds / BUCKET_SIZE), BUCKETS - 1);
+	buckets_[bucket]++;
+	count_++;
+	max_ = std::max(max_, seconds);
+}
+
+void DurationHistogram::Reset() {
+	memset(buckets_, 0, sizeof(buckets_));
+	count_ = 0;
+	max_ = 0.0;
+}
+
+double DurationHistogram::Percentile(double p) const {
+	if (count_ == 0)
+		return 0.0;
+	uint32_t target = std::max((uint32_t)ceil(std::min(std::max(p, 0.0), 1.0) * count_), 1U);
+	if (target >= (uint32_t)count_)
+		return max_;
+	uint32_t seen = 0;
+	for (int i = 0; i < BUCKETS; ++i) {
+		seen += buckets_[i];
+		if (seen >= target)
+			return std::min((i + 1) * BUCKET_SIZE, max_);
+	}
+	return max_;
+}
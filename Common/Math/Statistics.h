@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 
 // Very simple stat for convenience. Keeps track of min, max, smoothed.
 struct SimpleStat {
@@ -41,3 +42,24 @@ struct SimpleStat {
 	double max_;
 	double smoothed_;
 };
+
+// Histogram of durations (in seconds), so percentiles stay cheap no matter how many samples.
+// Buckets are 0.1ms wide up to 100ms, anything slower lands in the last one.
+class DurationHistogram {
+public:
+	void Add(double seconds);
+	void Reset();
+
+	int Count() const { return count_; }
+	double Max() const { return max_; }
+	// p is 0.0 - 1.0.  Accurate to the bucket size, never more than Max().
+	double Percentile(double p) const;
+
+private:
+	static constexpr int BUCKETS = 1000;
+	static constexpr double BUCKET_SIZE = 0.0001;
+
+	uint32_t buckets_[BUCKETS]{};
+	int count_ = 0;
+	double max_ = 0.0;
+};
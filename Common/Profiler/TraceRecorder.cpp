@@ -0,0 +1,161 @@
+// Chrome trace event recorder, see TraceRecorder.h.
+// Format reference: "Trace Event Format" document, linked from https://ui.perfetto.dev.
+
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Common/File/FileUtil.h"
+#include "Common/File/Path.h"
+#include "Common/Log.h"
+#include "Common/Profiler/TraceRecorder.h"
+#include "Common/Thread/ThreadUtil.h"
+#include "Common/TimeUtil.h"
+
+// Stop collecting past this, so a forgotten recording doesn't eat all memory (about 256MB.)
+static const size_t MAX_EVENTS = 8 * 1024 * 1024;
+
+struct TraceEvent {
+	const char *category;
+	const char *name;
+	double start;
+	// Negative for instant events.
+	double end;
+};
+
+// Each thread appends to its own buffer, the lock is only contended while writing the file.
+struct TraceThreadBuffer {
+	std::mutex lock;
+	std::vector<TraceEvent> events;
+	std::string threadName;
+	int tid;
+};
+
+std::atomic<bool> g_traceRecording;
+
+static std::mutex g_buffersLock;
+// Buffers are never freed, since threads keep a pointer to theirs.
+static std::vector<std::unique_ptr<TraceThreadBuffer>> g_buffers;
+static thread_local TraceThreadBuffer *t_buffer = nullptr;
+static std::atomic<size_t> g_eventCount;
+static Path g_tracePath;
+static double g_traceStart;
+
+static TraceThreadBuffer *GetThreadBuffer() {
+	if (!t_buffer) {
+		std::lock_guard<std::mutex> guard(g_buffersLock);
+		TraceThreadBuffer *buffer = new TraceThreadBuffer();
+		const char *name = GetCurrentThreadName();
+		buffer->threadName = name ? name : "";
+		buffer->tid = (int)g_buffers.size() + 1;
+		g_buffers.push_back(std::unique_ptr<TraceThreadBuffer>(buffer));
+		t_buffer = buffer;
+	}
+	return t_buffer;
+}
+
+static void AddEvent(const TraceEvent &ev) {
+	if (g_eventCount.fetch_add(1, std::memory_order_relaxed) >= MAX_EVENTS) {
+		if (g_traceRecording.exchange(false))
+			WARN_LOG(Log::System, "Trace recording reached %d events, ignoring further events", (int)MAX_EVENTS);
+		return;
+	}
+
+	TraceThreadBuffer *buffer = GetThreadBuffer();
+	std::lock_guard<std::mutex> guard(buffer->lock);
+	buffer->events.push_back(ev);
+}
+
+void TraceRecorder_AddSpan(const char *category, const char *name, double start, double end) {
+	if (!TraceRecorder_IsRecording())
+		return;
+	AddEvent(TraceEvent{ category, name, start, end });
+}
+
+void TraceRecorder_AddInstant(const char *category, const char *name) {
+	if (!TraceRecorder_IsRecording())
+		return;
+	AddEvent(TraceEvent{ category, name, time_now_d(), -1.0 });
+}
+
+bool TraceRecorder_Start(const Path &filename) {
+	std::lock_guard<std::mutex> guard(g_buffersLock);
+	if (g_traceRecording) {
+		WARN_LOG(Log::System, "Trace recording already active, writing to %s", g_tracePath.c_str());
+		return false;
+	}
+
+	for (auto &buffer : g_buffers) {
+		std::lock_guard<std::mutex> bufferGuard(buffer->lock);
+		buffer->events.clear();
+	}
+	g_eventCount = 0;
+	g_tracePath = filename;
+	g_traceStart = time_now_d();
+	g_traceRecording = true;
+	INFO_LOG(Log::System, "Started trace recording to %s", filename.c_str());
+	return true;
+}
+
+static void WriteEscaped(FILE *fp, const char *str) {
+	for (const char *p = str ? str : ""; *p; ++p) {
+		if (*p == '"' || *p == '\\')
+			fputc('\\', fp);
+		if ((unsigned char)*p >= 0x20)
+			fputc(*p, fp);
+	}
+}
+
+bool TraceRecorder_Stop() {
+	std::lock_guard<std::mutex> guard(g_buffersLock);
+	if (g_tracePath.empty())
+		return false;
+	// Might already be false if we hit MAX_EVENTS.
+	g_traceRecording = false;
+
+	Path path = g_tracePath;
+	g_tracePath.clear();
+
+	FILE *fp = File::OpenCFile(path, "wb");
+	if (!fp) {
+		ERROR_LOG(Log::System, "Unable to open %s to write trace", path.c_str());
+		return false;
+	}
+
+	size_t total = 0;
+	fprintf(fp, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	bool first = true;
+	for (auto &buffer : g_buffers) {
+		std::lock_guard<std::mutex> bufferGuard(buffer->lock);
+		if (buffer->events.empty())
+			continue;
+
+		fprintf(fp, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"", first ? "" : ",\n", buffer->tid);
+		WriteEscaped(fp, buffer->threadName.c_str());
+		fprintf(fp, "\"}}");
+		first = false;
+
+		for (const TraceEvent &ev : buffer->events) {
+			fprintf(fp, ",\n{\"name\":\"");
+			WriteEscaped(fp, ev.name);
+			fprintf(fp, "\",\"cat\":\"");
+			WriteEscaped(fp, ev.category);
+			double ts = (ev.start - g_traceStart) * 1000000.0;
+			if (ev.end < 0.0)
+				fprintf(fp, "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}", ts, buffer->tid);
+			else
+				fprintf(fp, "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}", ts, (ev.end - ev.start) * 1000000.0, buffer->tid);
+		}
+		total += buffer->events.size();
+		buffer->events.clear();
+		buffer->events.shrink_to_fit();
+	}
+	fprintf(fp, "\n]}\n");
+	bool success = ferror(fp) == 0;
+	fclose(fp);
+
+	INFO_LOG(Log::System, "Wrote %d trace events to %s", (int)total, path.c_str());
+	return success;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+// Records timestamped spans from any thread, and writes them out in the Chrome trace event
+// JSON format, which can be loaded in chrome://tracing or https://ui.perfetto.dev.
+//
+// Unlike Profiler.h, this is always compiled in. When not recording, a span costs one branch.
+
+#include <atomic>
+#include <cstdint>
+
+#include "Common/TimeUtil.h"
+
+class Path;
+
+extern std::atomic<bool> g_traceRecording;
+
+inline bool TraceRecorder_IsRecording() {
+	return g_traceRecording.load(std::memory_order_relaxed);
+}
+
+// Starts collecting events in memory. They are written to filename by TraceRecorder_Stop().
+bool TraceRecorder_Start(const Path &filename);
+// Returns false if there was no recording or the file couldn't be written.
+bool TraceRecorder_Stop();
+
+// The category and name strings must outlive the recording (string literals, HLE function names, etc.)
+// Times are from time_now_d().
+void TraceRecorder_AddSpan(const char *category, const char *name, double start, double end);
+void TraceRecorder_AddInstant(const char *category, const char *name);
+
+class TraceSpan {
+public:
+	TraceSpan(const char *category, const char *name) {
+		if (TraceRecorder_IsRecording()) {
+			category_ = category;
+			name_ = name;
+			start_ = time_now_d();
+		}
+	}
+	~TraceSpan() {
+		if (category_)
+			TraceRecorder_AddSpan(category_, name_, start_, time_now_d());
+	}
+
+private:
+	const char *category_ = nullptr;
+	const char *name_ = nullptr;
+	double start_ = 0.0;
+};
+
+#define TRACE_SCOPE(cat, name) TraceSpan _trace_scoped(cat, name);
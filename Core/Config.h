@@ -117,6 +117,8 @@ struct Config {
 	bool bHideStateWarnings;
 	bool bPreloadFunctions;
 	uint32_t uJitDisableFlags;
+	// Rounds differently from the interpreter and other hosts, which breaks replays and netplay.
+	bool bJitFuseFMA;
 
 	bool bDisableHTTPS;
 
@@ -126,6 +128,8 @@ struct Config {
 	bool bAutoSaveSymbolMap;
 	bool bCompressSymbols;
 	bool bCacheFullIsoInRam;
+	// Share the RAM cached ISO with other PPSSPP processes running the same game (POSIX only.)
+	bool bSharedMemoryCache;
 	int iRemoteISOPort;
 	std::string sLastRemoteISOServer;
 	int iLastRemoteISOPort;
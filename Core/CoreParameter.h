@@ -29,6 +29,8 @@ enum GPUCore : int {
 	GPUCORE_DIRECTX9,
 	GPUCORE_DIRECTX11,
 	GPUCORE_VULKAN,
+	// No rendering at all, only for benchmarking (headless).
+	GPUCORE_NULL,
 };
 
 enum class FPSLimit {
@@ -30,6 +30,8 @@
 #include "Core/CoreTiming.h"
 #include "Core/Core.h"
 #include "Core/Config.h"
+#include "Core/Debugger/SamplingProfiler.h"
+#include "Core/MemFault.h"
 #include "Core/HLE/sceKernelThread.h"
 #include "Core/MIPS/MIPS.h"
 
@@ -396,6 +398,12 @@ void Advance() {
 	globalTimer += cyclesExecuted;
 	currentMIPS->downcount = slicelength;
 
+	int maxSlice = MAX_SLICE_LENGTH;
+	if (SamplingProfiler_IsActive())
+		maxSlice = SamplingProfiler_Sample(globalTimer);
+	if (Memory::MemWatch_HasHits())
+		Memory::MemWatch_ReportHits();
+
 	ProcessEvents();
 
 	if (!first) {
@@ -407,8 +415,8 @@ void Advance() {
 	} else {
 		// Note that events can eat cycles as well.
 		int target = (int)(first->time - globalTimer);
-		if (target > MAX_SLICE_LENGTH)
-			target = MAX_SLICE_LENGTH;
+		if (target > maxSlice)
+			target = maxSlice;
 
 		const int diff = target - slicelength;
 		slicelength += diff;
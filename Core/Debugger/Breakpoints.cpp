@@ -24,11 +24,13 @@
 #include "Core/Debugger/Breakpoints.h"
 #include "Core/Debugger/MemBlockInfo.h"
 #include "Core/Debugger/SymbolMap.h"
+#include "Core/MemFault.h"
 #include "Core/MemMap.h"
 #include "Core/MIPS/MIPSAnalyst.h"
 #include "Core/MIPS/MIPSDebugInterface.h"
 #include "Core/MIPS/JitCommon/JitCommon.h"
 #include "Core/CoreTiming.h"
+#include "Core/System.h"
 
 BreakpointManager g_breakpoints;
 
@@ -456,13 +458,16 @@ MemCheck *BreakpointManager::GetMemCheckLocked(u32 address, int size) {
 	return 0;
 }
 
-BreakAction BreakpointManager::ExecMemCheck(u32 address, bool write, int size, u32 pc, const char *reason)
+BreakAction BreakpointManager::ExecMemCheck(u32 address, bool write, int size, u32 pc, const char *reason, bool changed)
 {
 	if (!anyMemChecks_)
 		return BREAK_ACTION_IGNORE;
 	std::unique_lock<std::mutex> guard(memCheckMutex_);
 	auto check = GetMemCheckLocked(address, size);
 	if (check) {
+		int mask = MEMCHECK_WRITE | MEMCHECK_WRITE_ONCHANGE;
+		if (write && !changed && (check->cond & mask) == mask)
+			return BREAK_ACTION_IGNORE;
 		BreakAction applyAction = check->Apply(address, write, size, pc);
 		if (applyAction == BREAK_ACTION_IGNORE)
 			return applyAction;
@@ -572,6 +577,27 @@ void BreakpointManager::UpdateCachedMemCheckRanges() {
 	}
 }
 
+bool BreakpointManager::HasJitMemChecks() const {
+	return anyMemChecks_ && !Memory::MemWatch_IsActive();
+}
+
+void BreakpointManager::UpdateMemWatch() {
+	std::vector<Memory::MemWatchRange> ranges;
+	// The interpreters don't fault on watched pages, only jitted accesses are reported.
+	CPUCore core = PSP_CoreParameter().cpuCore;
+	if (anyMemChecks_ && PSP_IsInited() && (core == CPUCore::JIT || core == CPUCore::JIT_IR)) {
+		std::lock_guard<std::mutex> guard(memCheckMutex_);
+		for (const auto &check : memChecks_) {
+			u32 end = check.end == 0 ? check.start + 1 : check.end;
+			ranges.push_back(Memory::MemWatchRange{ check.start, end, (check.cond & MEMCHECK_READ) != 0 });
+		}
+	}
+
+	memWatchApplied_ = Memory::MemWatch_SetRanges(ranges) && !ranges.empty();
+	if (!ranges.empty() && !memWatchApplied_)
+		INFO_LOG(Log::JIT, "Memory checks can't use page protection, checking in the jit instead");
+}
+
 std::vector<MemCheck> BreakpointManager::GetMemCheckRanges(bool write) {
 	std::lock_guard<std::mutex> guard(memCheckMutex_);
 	if (write)
@@ -590,12 +616,21 @@ std::vector<BreakPoint> BreakpointManager::GetBreakpoints() {
 }
 
 void BreakpointManager::Frame() {
+	// Memory was reinitialized (or the game only just started), so the watched pages need protecting again.
+	if (memWatchApplied_ && !Memory::MemWatch_IsActive() && PSP_IsInited()) {
+		std::lock_guard<std::mutex> guard(memCheckMutex_);
+		Update();
+	}
+
 	// outside the lock here, should be ok.
 	if (!needsUpdate_) {
 		return;
 	}
 
 	std::lock_guard<std::mutex> guard(breakPointsMutex_);
+	// This decides whether the jit checks memory itself, so do it before clearing.
+	if (updateAddr_ != -1)
+		UpdateMemWatch();
 	if (MIPSComp::jit && updateAddr_ != -1) {
 		// In case this is a delay slot, clear the previous instruction too.
 		if (updateAddr_ != 0)
@@ -156,7 +156,8 @@ class BreakpointManager {
 
 	bool GetMemCheck(u32 start, u32 end, MemCheck *check);
 	bool GetMemCheckInRange(u32 address, int size, MemCheck *check);
-	BreakAction ExecMemCheck(u32 address, bool write, int size, u32 pc, const char *reason);
+	// changed is for writes that already happened, to honor MEMCHECK_WRITE_ONCHANGE.
+	BreakAction ExecMemCheck(u32 address, bool write, int size, u32 pc, const char *reason, bool changed = true);
 	BreakAction ExecOpMemCheck(u32 address, u32 pc);
 
 	void SetSkipFirst(u32 pc);
@@ -183,6 +184,8 @@ class BreakpointManager {
 	bool HasMemChecks() const {
 		return anyMemChecks_;
 	}
+	// False when the memchecks are caught through page protection instead (see MemFault.h.)
+	bool HasJitMemChecks() const;
 
 	void Frame();
 
@@ -200,6 +203,7 @@ class BreakpointManager {
 	size_t FindMemCheck(u32 start, u32 end);
 	MemCheck *GetMemCheckLocked(u32 address, int size);
 	void UpdateCachedMemCheckRanges();
+	void UpdateMemWatch();
 
 	std::atomic<bool> anyBreakPoints_;
 	std::atomic<bool> anyMemChecks_;
@@ -217,6 +221,8 @@ class BreakpointManager {
 
 	bool needsUpdate_ = true;
 	u32 updateAddr_ = 0;
+	// Only touched in Frame().
+	bool memWatchApplied_ = false;
 };
 
 extern BreakpointManager g_breakpoints;
@@ -0,0 +1,209 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+#include "Common/File/FileUtil.h"
+#include "Common/File/Path.h"
+#include "Common/Log.h"
+#include "Common/Log/LogManager.h"
+#include "Common/StringUtils.h"
+#include "Core/CoreTiming.h"
+#include "Core/Debugger/SamplingProfiler.h"
+#include "Core/Debugger/SymbolMap.h"
+#include "Core/HLE/HLE.h"
+#include "Core/HLE/sceKernelThread.h"
+#include "Core/MemMap.h"
+#include "Core/MIPS/MIPS.h"
+#include "Core/MIPS/MIPSStackWalk.h"
+#include "GPU/GPU.h"
+#include "GPU/GPUCommon.h"
+
+// Deeper frames are dropped, the stack walk gets unreliable that far out anyway.
+static const size_t MAX_FRAMES = 32;
+
+std::atomic<bool> g_samplingProfilerActive;
+
+static std::atomic<int> g_intervalCycles;
+static std::atomic<bool> g_restarted;
+// Only touched on the emu thread.
+static int64_t g_nextSampleTicks;
+
+static std::mutex g_samplesLock;
+static std::unordered_map<std::string, uint32_t> g_samples;
+static int g_sampleCount;
+static int g_geBusyCount;
+
+void SamplingProfiler_Start(int intervalUs) {
+	g_intervalCycles = std::max(1, (int)usToCycles(std::max(intervalUs, 10)));
+	g_restarted = true;
+	if (!g_samplingProfilerActive.exchange(true))
+		INFO_LOG(Log::CPU, "Started sampling profiler, every %d us", intervalUs);
+}
+
+void SamplingProfiler_Stop() {
+	if (g_samplingProfilerActive.exchange(false))
+		INFO_LOG(Log::CPU, "Stopped sampling profiler, %d samples", g_sampleCount);
+}
+
+void SamplingProfiler_Clear() {
+	std::lock_guard<std::mutex> guard(g_samplesLock);
+	g_samples.clear();
+	g_sampleCount = 0;
+	g_geBusyCount = 0;
+}
+
+static void AppendFrame(std::string &stack, const char *prefix, const char *name) {
+	if (!stack.empty())
+		stack += ';';
+	stack += prefix;
+	// Semicolons separate frames and newlines separate stacks, so neither can be in names.
+	for (const char *p = name; *p; ++p)
+		stack += *p == ';' || *p == '\n' ? ':' : *p;
+}
+
+static void AppendFunction(std::string &stack, const MIPSStackWalk::StackFrame &frame) {
+	u32 start = g_symbolMap ? g_symbolMap->GetFunctionStart(frame.pc) : SymbolMap::INVALID_ADDRESS;
+	if (start == SymbolMap::INVALID_ADDRESS)
+		start = frame.entry;
+	std::string name = g_symbolMap ? g_symbolMap->GetLabelString(start) : "";
+	if (!name.empty()) {
+		AppendFrame(stack, "", name.c_str());
+	} else {
+		char temp[16];
+		snprintf(temp, sizeof(temp), "z_un_%08x", start);
+		AppendFrame(stack, "", temp);
+	}
+}
+
+int SamplingProfiler_Sample(int64_t globalTicks) {
+	int interval = g_intervalCycles;
+	if (g_restarted.exchange(false))
+		g_nextSampleTicks = 0;
+	// Also resample if time went backwards, like after loading a savestate.
+	if (globalTicks < g_nextSampleTicks && g_nextSampleTicks - globalTicks <= interval)
+		return (int)(g_nextSampleTicks - globalTicks);
+	// Idling skips time in one go, so count the intervals we missed.  Otherwise idle would barely show.
+	uint32_t weight = 1;
+	if (g_nextSampleTicks != 0 && globalTicks >= g_nextSampleTicks)
+		weight += (uint32_t)std::min((globalTicks - g_nextSampleTicks) / interval, (int64_t)1000);
+	g_nextSampleTicks = globalTicks + interval;
+
+	std::string stack = hleCurrentThreadName ? hleCurrentThreadName : "(no thread)";
+	u32 pc = currentMIPS->pc;
+	if (Memory::IsValidAddress(pc)) {
+		u32 ra = currentMIPS->r[MIPS_REG_RA];
+		u32 sp = currentMIPS->r[MIPS_REG_SP];
+		std::vector<MIPSStackWalk::StackFrame> frames = MIPSStackWalk::Walk(pc, ra, sp, __KernelGetCurThreadEntry(), __KernelGetCurThreadStack());
+		size_t count = std::min(frames.size(), MAX_FRAMES);
+		for (size_t i = count; i > 0; --i)
+			AppendFunction(stack, frames[i - 1]);
+	}
+
+	const char *syscall = hleGetCurrentSyscallName();
+	if (syscall)
+		AppendFrame(stack, "[HLE] ", syscall);
+
+	bool geBusy = gpu && gpu->DrawPendingAt(globalTicks);
+
+	std::lock_guard<std::mutex> guard(g_samplesLock);
+	g_samples[stack] += weight;
+	g_sampleCount += weight;
+	if (geBusy)
+		g_geBusyCount += weight;
+	return interval;
+}
+
+int SamplingProfiler_GetSampleCount(int *geBusySamples) {
+	std::lock_guard<std::mutex> guard(g_samplesLock);
+	if (geBusySamples)
+		*geBusySamples = g_geBusyCount;
+	return g_sampleCount;
+}
+
+std::string SamplingProfiler_GetFolded() {
+	std::vector<std::pair<std::string, uint32_t>> sorted;
+	{
+		std::lock_guard<std::mutex> guard(g_samplesLock);
+		sorted.assign(g_samples.begin(), g_samples.end());
+	}
+	// Sorted for stable output, which makes diffs between runs readable.
+	std::sort(sorted.begin(), sorted.end());
+
+	std::string folded;
+	for (const auto &it : sorted) {
+		folded += it.first;
+		folded += StringFromFormat(" %u\n", it.second);
+	}
+	return folded;
+}
+
+bool SamplingProfiler_WriteFolded(const Path &filename) {
+	std::string folded = SamplingProfiler_GetFolded();
+	FILE *fp = File::OpenCFile(filename, "wb");
+	if (!fp) {
+		ERROR_LOG(Log::CPU, "Unable to open %s to write profile", filename.c_str());
+		return false;
+	}
+	bool success = fwrite(folded.data(), 1, folded.size(), fp) == folded.size();
+	fclose(fp);
+
+	INFO_LOG(Log::CPU, "Wrote %d profiler samples to %s", SamplingProfiler_GetSampleCount(nullptr), filename.c_str());
+	return success;
+}
+
+std::vector<SamplingProfilerFunction> SamplingProfiler_GetFunctions(size_t maxCount) {
+	std::map<std::string, SamplingProfilerFunction> functions;
+	{
+		std::lock_guard<std::mutex> guard(g_samplesLock);
+		for (const auto &it : g_samples) {
+			std::vector<std::string> frames;
+			SplitString(it.first, ';', frames);
+			// The first frame is the thread, not a function.
+			if (frames.size() < 2)
+				continue;
+			frames.erase(frames.begin());
+
+			for (size_t i = 0; i < frames.size(); ++i) {
+				SamplingProfilerFunction &func = functions[frames[i]];
+				// Recursive functions only count once per stack.
+				if (std::find(frames.begin(), frames.begin() + i, frames[i]) == frames.begin() + i)
+					func.total += it.second;
+			}
+			functions[frames.back()].self += it.second;
+		}
+	}
+
+	std::vector<SamplingProfilerFunction> result;
+	result.reserve(functions.size());
+	for (auto &it : functions) {
+		it.second.name = it.first;
+		result.push_back(std::move(it.second));
+	}
+	std::sort(result.begin(), result.end(), [](const SamplingProfilerFunction &a, const SamplingProfilerFunction &b) {
+		if (a.self != b.self)
+			return a.self > b.self;
+		return a.total > b.total;
+	});
+	if (result.size() > maxCount)
+		result.resize(maxCount);
+	return result;
+}
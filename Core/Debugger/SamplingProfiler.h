@@ -0,0 +1,60 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#pragma once
+
+// Samples the guest call stack every so many emulated cycles, from CoreTiming::Advance().
+// That's where the PC is accurate no matter which CPU core is used, so this works in
+// regular builds and is cheap enough to leave running.  When not sampling, it costs a branch.
+//
+// Samples are aggregated as folded stacks: "thread;outer;inner;[HLE] sceFoo count" per line,
+// which flamegraph.pl, speedscope, and inferno can read.
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Path;
+
+struct SamplingProfilerFunction {
+	std::string name;
+	// Samples where this function was executing.
+	uint32_t self = 0;
+	// Samples where this function was anywhere on the stack.
+	uint32_t total = 0;
+};
+
+extern std::atomic<bool> g_samplingProfilerActive;
+
+inline bool SamplingProfiler_IsActive() {
+	return g_samplingProfilerActive.load(std::memory_order_relaxed);
+}
+
+// Starts (or resumes) sampling every intervalUs of emulated time.  Keeps previous samples.
+void SamplingProfiler_Start(int intervalUs = 1000);
+void SamplingProfiler_Stop();
+void SamplingProfiler_Clear();
+
+// Called on the emu thread from CoreTiming::Advance().  Returns the max cycles until the next call.
+int SamplingProfiler_Sample(int64_t globalTicks);
+
+int SamplingProfiler_GetSampleCount(int *geBusySamples);
+std::string SamplingProfiler_GetFolded();
+bool SamplingProfiler_WriteFolded(const Path &filename);
+// Sorted by self samples, most first.
+std::vector<SamplingProfilerFunction> SamplingProfiler_GetFunctions(size_t maxCount);
@@ -18,6 +18,7 @@
 #include <mutex>
 #include <vector>
 #include "Core/Debugger/WebSocket/GPUStatsSubscriber.h"
+#include "Core/FrameTiming.h"
 #include "Core/HW/Display.h"
 #include "Core/System.h"
 
@@ -71,6 +72,9 @@ struct WebSocketGPUStatsState : public DebuggerSubscriber {
 	~WebSocketGPUStatsState();
 	void Get(DebuggerRequest &req);
 	void Feed(DebuggerRequest &req);
+	void FrameTimesStart(DebuggerRequest &req);
+	void FrameTimesStop(DebuggerRequest &req);
+	void FrameTimesGet(DebuggerRequest &req);
 
 	void Broadcast(net::WebSocketServer *ws) override;
 
@@ -79,6 +83,7 @@ struct WebSocketGPUStatsState : public DebuggerSubscriber {
 
 protected:
 	bool forced_ = false;
+	bool recordingFrameTimes_ = false;
 	bool sendNext_ = false;
 	bool sendFeed_ = false;
 
@@ -91,6 +96,9 @@ DebuggerSubscriber *WebSocketGPUStatsInit(DebuggerEventHandlerMap &map) {
 	auto p = new WebSocketGPUStatsState();
 	map["gpu.stats.get"] = std::bind(&WebSocketGPUStatsState::Get, p, std::placeholders::_1);
 	map["gpu.stats.feed"] = std::bind(&WebSocketGPUStatsState::Feed, p, std::placeholders::_1);
+	map["gpu.stats.frameTimes.start"] = std::bind(&WebSocketGPUStatsState::FrameTimesStart, p, std::placeholders::_1);
+	map["gpu.stats.frameTimes.stop"] = std::bind(&WebSocketGPUStatsState::FrameTimesStop, p, std::placeholders::_1);
+	map["gpu.stats.frameTimes.get"] = std::bind(&WebSocketGPUStatsState::FrameTimesGet, p, std::placeholders::_1);
 
 	return p;
 }
@@ -102,6 +110,8 @@ WebSocketGPUStatsState::WebSocketGPUStatsState() {
 WebSocketGPUStatsState::~WebSocketGPUStatsState() {
 	if (forced_)
 		PSP_ForceDebugStats(false);
+	if (recordingFrameTimes_)
+		g_frameTiming.StopRecording();
 	__DisplayForgetFlip(&WebSocketGPUStatsState::FlipForwarder, this);
 }
 
@@ -183,6 +193,61 @@ void WebSocketGPUStatsState::Feed(DebuggerRequest &req) {
 	}
 }
 
+// Start recording per-frame timing (gpu.stats.frameTimes.start)
+//
+// Clears anything recorded before.  Recording continues until gpu.stats.frameTimes.stop or disconnect.
+//
+// No parameters.
+//
+// Response (same event name) with no extra data.
+void WebSocketGPUStatsState::FrameTimesStart(DebuggerRequest &req) {
+	g_frameTiming.StartRecording();
+	recordingFrameTimes_ = true;
+	req.Respond();
+}
+
+// Stop recording per-frame timing (gpu.stats.frameTimes.stop)
+//
+// What was recorded can still be retrieved with gpu.stats.frameTimes.get.
+//
+// No parameters.
+//
+// Response (same event name) with no extra data.
+void WebSocketGPUStatsState::FrameTimesStop(DebuggerRequest &req) {
+	g_frameTiming.StopRecording();
+	recordingFrameTimes_ = false;
+	req.Respond();
+}
+
+// Get frame time percentiles (gpu.stats.frameTimes.get)
+//
+// No parameters.
+//
+// Response (same event name):
+//  - recording: boolean, true if still recording.
+//  - frames: unsigned integer, number of frames recorded.
+//  - total, cpu, ge, presentWait, vblankLate: objects with properties, all in milliseconds:
+//     - p50: number, median.
+//     - p95: number, 95th percentile.
+//     - p99: number, 99th percentile.
+//     - max: number, slowest frame.
+//
+// Note: percentiles are accurate to 0.1ms.  vblankLate is only counted when throttling.
+void WebSocketGPUStatsState::FrameTimesGet(DebuggerRequest &req) {
+	JsonWriter &json = req.Respond();
+	json.writeBool("recording", g_frameTiming.IsRecording());
+	json.writeUint("frames", g_frameTiming.RecordedFrames());
+	for (int i = 0; i < (int)FrameTimeMetric::COUNT; ++i) {
+		FrameTimeMetric metric = (FrameTimeMetric)i;
+		json.pushDict(FrameTimeMetricToString(metric));
+		json.writeFloat("p50", g_frameTiming.Percentile(metric, 0.50) * 1000.0);
+		json.writeFloat("p95", g_frameTiming.Percentile(metric, 0.95) * 1000.0);
+		json.writeFloat("p99", g_frameTiming.Percentile(metric, 0.99) * 1000.0);
+		json.writeFloat("max", g_frameTiming.Max(metric) * 1000.0);
+		json.pop();
+	}
+}
+
 void WebSocketGPUStatsState::Broadcast(net::WebSocketServer *ws) {
 	std::lock_guard<std::mutex> guard(pendingLock_);
 	if (lastTicket_.empty() && !sendFeed_) {
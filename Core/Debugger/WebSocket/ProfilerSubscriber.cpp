@@ -0,0 +1,129 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#include "Core/Debugger/SamplingProfiler.h"
+#include "Core/Debugger/WebSocket/ProfilerSubscriber.h"
+
+DebuggerSubscriber *WebSocketProfilerInit(DebuggerEventHandlerMap &map) {
+	// No need to bind or alloc state, these are all global.
+	map["profiler.start"] = &WebSocketProfilerStart;
+	map["profiler.stop"] = &WebSocketProfilerStop;
+	map["profiler.clear"] = &WebSocketProfilerClear;
+	map["profiler.status"] = &WebSocketProfilerStatus;
+	map["profiler.folded"] = &WebSocketProfilerFolded;
+	map["profiler.functions"] = &WebSocketProfilerFunctions;
+
+	return nullptr;
+}
+
+// Start sampling the guest call stack (profiler.start)
+//
+// Samples keep accumulating until profiler.clear, including across stop and start.
+//
+// Parameters:
+//  - interval: optional unsigned integer, microseconds of emulated time between samples (default 1000.)
+//
+// Response (same event name) with no extra data.
+void WebSocketProfilerStart(DebuggerRequest &req) {
+	uint32_t interval = 1000;
+	if (!req.ParamU32("interval", &interval, false, DebuggerParamType::OPTIONAL))
+		return;
+	if (interval == 0 || interval > 1000000)
+		return req.Fail("Invalid interval");
+
+	SamplingProfiler_Start((int)interval);
+	req.Respond();
+}
+
+// Stop sampling (profiler.stop)
+//
+// No parameters.
+//
+// Response (same event name) with no extra data.
+void WebSocketProfilerStop(DebuggerRequest &req) {
+	SamplingProfiler_Stop();
+	req.Respond();
+}
+
+// Discard all collected samples (profiler.clear)
+//
+// No parameters.
+//
+// Response (same event name) with no extra data.
+void WebSocketProfilerClear(DebuggerRequest &req) {
+	SamplingProfiler_Clear();
+	req.Respond();
+}
+
+// Get profiler status (profiler.status)
+//
+// No parameters.
+//
+// Response (same event name):
+//  - active: boolean, true if currently sampling.
+//  - samples: unsigned integer, number of samples collected.
+//  - geBusySamples: unsigned integer, samples taken while the GE was still processing a list.
+void WebSocketProfilerStatus(DebuggerRequest &req) {
+	int geBusy = 0;
+	int samples = SamplingProfiler_GetSampleCount(&geBusy);
+
+	JsonWriter &json = req.Respond();
+	json.writeBool("active", SamplingProfiler_IsActive());
+	json.writeUint("samples", samples);
+	json.writeUint("geBusySamples", geBusy);
+}
+
+// Get samples as folded stacks (profiler.folded)
+//
+// Each line is "thread;outer;...;inner count", the format used by flamegraph.pl and speedscope.
+// If sampled during a syscall, the innermost frame is "[HLE] name".
+//
+// No parameters.
+//
+// Response (same event name):
+//  - folded: string, lines of folded stacks.
+void WebSocketProfilerFolded(DebuggerRequest &req) {
+	JsonWriter &json = req.Respond();
+	json.writeString("folded", SamplingProfiler_GetFolded());
+}
+
+// Get the hottest functions (profiler.functions)
+//
+// Parameters:
+//  - count: optional unsigned integer, maximum functions to return (default 50.)
+//
+// Response (same event name):
+//  - functions: array of objects, sorted by self samples, each with:
+//     - name: string, function name or z_un_ address if there's no symbol.
+//     - self: unsigned integer, samples inside this function itself.
+//     - total: unsigned integer, samples with this function anywhere on the stack.
+void WebSocketProfilerFunctions(DebuggerRequest &req) {
+	uint32_t count = 50;
+	if (!req.ParamU32("count", &count, false, DebuggerParamType::OPTIONAL))
+		return;
+
+	JsonWriter &json = req.Respond();
+	json.pushArray("functions");
+	for (const SamplingProfilerFunction &func : SamplingProfiler_GetFunctions(count)) {
+		json.pushDict();
+		json.writeString("name", func.name);
+		json.writeUint("self", func.self);
+		json.writeUint("total", func.total);
+		json.pop();
+	}
+	json.pop();
+}
@@ -16,6 +16,8 @@
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
 
+#include <algorithm>
+
 #include "ppsspp_config.h"
 
 #include "Common/Log.h"
@@ -42,6 +44,32 @@
 
 #if !defined(_WIN32) && !defined(HAVE_LIBRETRO_VFS)
 
+// How far ahead to ask the kernel to read when we see sequential reads.
+static const s64 READ_AHEAD_WINDOW = 512 * 1024;
+
+void LocalFileLoader::ReadAheadIfSequential(s64 absolutePos, s64 size) {
+#if PPSSPP_PLATFORM(LINUX)
+	// Reads continuing where the last one ended are likely streaming (movies, audio.)
+	// Let the kernel fetch the next chunk in the background so the next read doesn't block on the disk.
+	s64 end = absolutePos + size;
+	if (nextSequentialPos_.exchange(end, std::memory_order_relaxed) != absolutePos) {
+		// A new stream might start here.  Forget what we hinted for the old one, it may be far ahead after a backward seek.
+		readAheadEnd_.store(end, std::memory_order_relaxed);
+		return;
+	}
+
+	s64 hintedEnd = readAheadEnd_.load(std::memory_order_relaxed);
+	if (hintedEnd - end >= READ_AHEAD_WINDOW / 2)
+		return;
+	s64 start = std::max(hintedEnd, end);
+	s64 newEnd = end + std::max(size, READ_AHEAD_WINDOW);
+	if (start >= (s64)filesize_)
+		return;
+	readAheadEnd_.store(newEnd, std::memory_order_relaxed);
+	posix_fadvise(fd_, start, newEnd - start, POSIX_FADV_WILLNEED);
+#endif
+}
+
 void LocalFileLoader::DetectSizeFd() {
 #if PPSSPP_PLATFORM(ANDROID) || (defined(_FILE_OFFSET_BITS) && _FILE_OFFSET_BITS < 64)
 	off64_t off = lseek64(fd_, 0, SEEK_END);
@@ -177,6 +205,10 @@ size_t LocalFileLoader::ReadAt(s64 absolutePos, size_t bytes, size_t count, void
 		return 0;
 	}
 
+#if !defined(_WIN32) && !defined(HAVE_LIBRETRO_VFS)
+	ReadAheadIfSequential(absolutePos, (s64)(bytes * count));
+#endif
+
 #if defined(HAVE_LIBRETRO_VFS)
     std::lock_guard<std::mutex> guard(readLock_);
 	filestream_seek(handle_, absolutePos, RETRO_VFS_SEEK_POSITION_START);
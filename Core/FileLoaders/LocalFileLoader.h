@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <mutex>
 
 #include "Common/CommonTypes.h"
@@ -49,7 +50,11 @@ class LocalFileLoader : public FileLoader {
 private:
 #if !defined(_WIN32) && !defined(HAVE_LIBRETRO_VFS)
 	void DetectSizeFd();
+	void ReadAheadIfSequential(s64 absolutePos, s64 size);
 	int fd_ = -1;
+	// For detecting streaming reads, see ReadAheadIfSequential().
+	std::atomic<s64> nextSequentialPos_{ -1 };
+	std::atomic<s64> readAheadEnd_{ 0 };
 #else
 	HANDLE handle_ = 0;
 #endif
@@ -19,17 +19,20 @@
 #include <thread>
 #include <cstring>
 
+#include "Common/File/DirListing.h"
 #include "Common/Thread/ThreadUtil.h"
 #include "Common/TimeUtil.h"
 #include "Common/Log.h"
 #include "Core/FileLoaders/RamCachingFileLoader.h"
+#include "Core/SharedCache.h"
+#include "ext/xxhash.h"
 
 // Takes ownership of backend.
-RamCachingFileLoader::RamCachingFileLoader(FileLoader *backend)
+RamCachingFileLoader::RamCachingFileLoader(FileLoader *backend, bool shared)
 	: ProxiedFileLoader(backend) {
 	filesize_ = backend->FileSize();
 	if (filesize_ > 0) {
-		InitCache();
+		InitCache(shared);
 	}
 }
 
@@ -86,11 +89,13 @@ size_t RamCachingFileLoader::ReadAt(s64 absolutePos, size_t bytes, void *data, F
 	return readSize;
 }
 
-void RamCachingFileLoader::InitCache() {
+void RamCachingFileLoader::InitCache(bool shared) {
 	std::lock_guard<std::mutex> guard(blocksMutex_);
 	u32 blockCount = (u32)((filesize_ + BLOCK_SIZE - 1) >> BLOCK_SHIFT);
-	// Overallocate for the last block.
-	cache_ = (u8 *)malloc((size_t)blockCount << BLOCK_SHIFT);
+	if (!shared || !InitSharedCache(blockCount)) {
+		// Overallocate for the last block.
+		cache_ = (u8 *)malloc((size_t)blockCount << BLOCK_SHIFT);
+	}
 	if (cache_ == nullptr) {
 		ERROR_LOG(Log::IO, "Failed to allocate cache for Cache full ISO in RAM! Will fall back to regular reads.");
 		return;
@@ -99,6 +104,39 @@ void RamCachingFileLoader::InitCache() {
 	blocks_.resize(blockCount);
 }
 
+bool RamCachingFileLoader::InitSharedCache(u32 blockCount) {
+	static_assert(sizeof(std::atomic<u8>) == 1 && std::atomic<u8>::is_always_lock_free, "Block flags must be plain bytes");
+
+	// Hashing the whole file would defeat the purpose, so key on where it is and when it last changed.
+	// Content based keys like the size and a few blocks can't tell patched ISOs apart.
+	File::FileInfo info;
+	if (!File::GetFileInfo(backend_->GetPath(), &info) || !info.exists || (s64)info.size != filesize_)
+		return false;
+	std::string path = backend_->GetPath().ToString();
+	XXH64_hash_t key = XXH3_64bits_withSeed(path.data(), path.size(), (XXH64_hash_t)filesize_);
+	const uint64_t times[2] = { info.mtime, info.ctime };
+	key = XXH3_64bits_withSeed(times, sizeof(times), key);
+
+	// Flags first, then the (overallocated) blocks.
+	size_t flagsSize = ((size_t)blockCount + 63) & ~(size_t)63;
+	shared_ = SharedCacheSegment::Open("iso", key, flagsSize + ((size_t)blockCount << BLOCK_SHIFT));
+	if (!shared_)
+		return false;
+
+	sharedBlocks_ = (std::atomic<u8> *)shared_->Data();
+	cache_ = shared_->Data() + flagsSize;
+	return true;
+}
+
+bool RamCachingFileLoader::PullSharedBlock(size_t i) {
+	if (!sharedBlocks_ || sharedBlocks_[i].load(std::memory_order_acquire) == 0)
+		return false;
+	blocks_[i] = 1;
+	if (aheadRemaining_ != 0)
+		aheadRemaining_--;
+	return true;
+}
+
 void RamCachingFileLoader::ShutdownCache() {
 	Cancel();
 
@@ -111,10 +149,14 @@ void RamCachingFileLoader::ShutdownCache() {
 
 	std::lock_guard<std::mutex> guard(blocksMutex_);
 	blocks_.clear();
-	if (cache_ != nullptr) {
+	if (shared_ != nullptr) {
+		delete shared_;
+		shared_ = nullptr;
+		sharedBlocks_ = nullptr;
+	} else if (cache_ != nullptr) {
 		free(cache_);
-		cache_ = nullptr;
 	}
+	cache_ = nullptr;
 }
 
 void RamCachingFileLoader::Cancel() {
@@ -148,7 +190,7 @@ size_t RamCachingFileLoader::ReadFromCache(s64 pos, size_t bytes, void *data) {
 
 	std::lock_guard<std::mutex> guard(blocksMutex_);
 	for (s64 i = cacheStartPos; i <= cacheEndPos; ++i) {
-		if (blocks_[(size_t)i] == 0) {
+		if (blocks_[(size_t)i] == 0 && !PullSharedBlock((size_t)i)) {
 			return readSize;
 		}
 
@@ -174,7 +216,7 @@ void RamCachingFileLoader::SaveIntoCache(s64 pos, size_t bytes, Flags flags) {
 	{
 		std::lock_guard<std::mutex> guard(blocksMutex_);
 		for (s64 i = cacheStartPos; i <= cacheEndPos; ++i) {
-			if (blocks_[(size_t)i] == 0) {
+			if (blocks_[(size_t)i] == 0 && !PullSharedBlock((size_t)i)) {
 				++blocksToRead;
 				if (blocksToRead >= MAX_BLOCKS_PER_READ) {
 					break;
@@ -185,6 +227,13 @@ void RamCachingFileLoader::SaveIntoCache(s64 pos, size_t bytes, Flags flags) {
 		}
 	}
 
+	if (blocksToRead == 0) {
+		// Another process already read them all.
+		return;
+	}
+
+	// Note: with a shared cache, this may rewrite blocks another process already published.
+	// That's harmless since the bytes are identical.
 	s64 cacheFilePos = cacheStartPos << BLOCK_SHIFT;
 	size_t bytesRead = backend_->ReadAt(cacheFilePos, blocksToRead << BLOCK_SHIFT, &cache_[cacheFilePos], flags);
 
@@ -200,6 +249,8 @@ void RamCachingFileLoader::SaveIntoCache(s64 pos, size_t bytes, Flags flags) {
 				blocks_[(size_t)cacheStartPos + i] = 1;
 				++blocksRead;
 			}
+			if (sharedBlocks_)
+				sharedBlocks_[(size_t)cacheStartPos + i].store(1, std::memory_order_release);
 		}
 
 		if (aheadRemaining_ != 0) {
@@ -262,7 +313,7 @@ u32 RamCachingFileLoader::NextAheadBlock() {
 	aheadPos_ = 0;
 
 	for (u32 i = startFrom; i < blocks_.size(); ++i) {
-		if (blocks_[i] == 0) {
+		if (blocks_[i] == 0 && !PullSharedBlock(i)) {
 			return i;
 		}
 	}
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <mutex>
 #include <thread>
@@ -24,9 +25,12 @@
 #include "Common/CommonTypes.h"
 #include "Core/Loaders.h"
 
+class SharedCacheSegment;
+
 class RamCachingFileLoader : public ProxiedFileLoader {
 public:
-	RamCachingFileLoader(FileLoader *backend);
+	// If shared is set, the cache is placed in shared memory so other processes running the same ISO can use it.
+	RamCachingFileLoader(FileLoader *backend, bool shared = false);
 	~RamCachingFileLoader();
 
 	bool Exists() override;
@@ -42,7 +46,10 @@ class RamCachingFileLoader : public ProxiedFileLoader {
 	void Cancel() override;
 
 private:
-	void InitCache();
+	void InitCache(bool shared);
+	bool InitSharedCache(u32 blockCount);
+	// Must hold blocksMutex_.  Returns true if another process already read the block.
+	bool PullSharedBlock(size_t i);
 	void ShutdownCache();
 	size_t ReadFromCache(s64 pos, size_t bytes, void *data);
 	// Guaranteed to read at least one block into the cache.
@@ -69,4 +76,8 @@ class RamCachingFileLoader : public ProxiedFileLoader {
 	std::thread aheadThread_;
 	bool aheadThreadRunning_ = false;
 	bool aheadCancel_ = false;
+
+	SharedCacheSegment *shared_ = nullptr;
+	// One flag per block in shared memory, set once the block's data is complete.
+	std::atomic<u8> *sharedBlocks_ = nullptr;
 };
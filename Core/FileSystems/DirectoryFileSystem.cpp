@@ -322,6 +322,14 @@ bool DirectoryFileHandle::Open(const Path &basePath, std::string &fileName, File
 	return success;
 }
 
+void DirectoryFileHandle::ResetReadPattern() {
+#if PPSSPP_PLATFORM(LINUX)
+	if (fullReads_ >= 2)
+		posix_fadvise(hFile, 0, 0, POSIX_FADV_NORMAL);
+	fullReads_ = 0;
+#endif
+}
+
 size_t DirectoryFileHandle::Read(u8* pointer, s64 size)
 {
 	size_t bytesRead = 0;
@@ -341,6 +349,16 @@ size_t DirectoryFileHandle::Read(u8* pointer, s64 size)
 		::ReadFile(hFile, (LPVOID)pointer, (DWORD)size, (LPDWORD)&bytesRead, 0);
 #else
 		bytesRead = read(hFile, pointer, size);
+#if PPSSPP_PLATFORM(LINUX)
+		// A few full reads in a row is probably streaming, so ask for more aggressive readahead.
+		// This lets the kernel fetch data in the background instead of blocking the next read.
+		if (bytesRead == (size_t)size) {
+			if (++fullReads_ == 2)
+				posix_fadvise(hFile, 0, 0, POSIX_FADV_SEQUENTIAL);
+		} else {
+			ResetReadPattern();
+		}
+#endif
 #endif
 	}
 	return replay_ ? ReplayApplyDiskRead(pointer, (uint32_t)bytesRead, (uint32_t)size, inGameDir_, CoreTiming::GetGlobalTimeUs()) : bytesRead;
@@ -427,6 +445,9 @@ size_t DirectoryFileHandle::Seek(s32 position, FileMove type)
 	case FILEMOVE_END:      moveMethod = SEEK_END;  break;
 	}
 	result = lseek(hFile, position, moveMethod);
+	// Just asking where we are (like Read does above) doesn't break a streaming pattern.
+	if (type != FILEMOVE_CURRENT || position != 0)
+		ResetReadPattern();
 #endif
 
 	return replay_ ? (size_t)ReplayApplyDisk64(ReplayAction::FILE_SEEK, result, CoreTiming::GetGlobalTimeUs()) : result;
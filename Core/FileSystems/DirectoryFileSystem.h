@@ -40,6 +40,8 @@ struct DirectoryFileHandle {
 	int hFile = -1;
 #endif
 	s64 needsTrunc_ = -1;
+	// Counts full reads in a row, to detect streaming and hint the OS (see Read.)
+	int fullReads_ = 0;
 	bool replay_ = true;
 	bool inGameDir_ = false;
 	FileSystemFlags fileSystemFlags_ = (FileSystemFlags)0;
@@ -54,6 +56,8 @@ struct DirectoryFileHandle {
 	size_t Read(u8* pointer, s64 size);
 	size_t Write(const u8* pointer, s64 size);
 	size_t Seek(s32 position, FileMove type);
+	// Called on a short read or a seek, which means the file isn't being streamed (anymore.)
+	void ResetReadPattern();
 	void Close();
 };
 
@@ -19,7 +19,11 @@
 // * Frame skipping. This gets complicated.
 // * The game not actually asking for flips, like in static loading screens
 
+#include <cstdio>
+
 #include "ppsspp_config.h"
+#include "Common/File/FileUtil.h"
+#include "Common/File/Path.h"
 #include "Common/Profiler/Profiler.h"
 #include "Common/Log.h"
 #include "Common/TimeUtil.h"
@@ -32,9 +36,13 @@
 #include "Core/HW/Display.h"
 #include "Core/HLE/sceNet.h"
 #include "Core/FrameTiming.h"
+#include "GPU/GPU.h"
 
 FrameTiming g_frameTiming;
 
+// An hour at 60 fps.
+static const size_t MAX_RECORDED_SAMPLES = 60 * 60 * 60;
+
 void WaitUntil(double now, double timestamp, const char *reason) {
 #if 1
 	// Use precise timing.
@@ -82,7 +90,10 @@ void FrameTiming::DeferWaitUntil(double until, double *curTimePtr) {
 
 void FrameTiming::PostSubmit() {
 	if (waitUntil_ != 0.0) {
-		WaitUntil(time_now_d(), waitUntil_, "post-submit");
+		double now = time_now_d();
+		WaitUntil(now, waitUntil_, "post-submit");
+		if (recording_)
+			NotifyWait(time_now_d() - now);
 		if (curTimePtr_) {
 			*curTimePtr_ = waitUntil_;
 			curTimePtr_ = nullptr;
@@ -91,6 +102,114 @@ void FrameTiming::PostSubmit() {
 	}
 }
 
+const char *FrameTimeMetricToString(FrameTimeMetric metric) {
+	switch (metric) {
+	case FrameTimeMetric::TOTAL: return "total";
+	case FrameTimeMetric::CPU: return "cpu";
+	case FrameTimeMetric::GE: return "ge";
+	case FrameTimeMetric::PRESENT_WAIT: return "presentWait";
+	case FrameTimeMetric::VBLANK_LATE: return "vblankLate";
+	default: return "N/A";
+	}
+}
+
+void FrameTiming::StartRecording() {
+	std::lock_guard<std::mutex> guard(recordLock_);
+	if (!recording_)
+		PSP_ForceDebugStats(true);
+	recording_ = true;
+	lastFlip_ = 0.0;
+	lastGETime_ = gpuStats.TotalProcessingDisplayLists();
+	current_ = {};
+	for (auto &hist : histograms_)
+		hist.Reset();
+	samples_.clear();
+}
+
+void FrameTiming::StopRecording() {
+	std::lock_guard<std::mutex> guard(recordLock_);
+	if (recording_)
+		PSP_ForceDebugStats(false);
+	recording_ = false;
+}
+
+void FrameTiming::NotifyFlip() {
+	if (!recording_)
+		return;
+
+	double now = time_now_d();
+	std::lock_guard<std::mutex> guard(recordLock_);
+	// The per-frame counter gets reset each host frame, so use the running total.  It only restarts with a new GPU.
+	double geTime = gpuStats.TotalProcessingDisplayLists();
+	double geDelta = geTime >= lastGETime_ ? geTime - lastGETime_ : geTime;
+	lastGETime_ = geTime;
+
+	if (lastFlip_ != 0.0) {
+		FrameTimeSample sample = current_;
+		sample.ge = geDelta;
+		sample.cpu = std::max(0.0, (now - lastFlip_) - sample.ge - sample.presentWait);
+
+		histograms_[(int)FrameTimeMetric::TOTAL].Add(sample.Total());
+		histograms_[(int)FrameTimeMetric::CPU].Add(sample.cpu);
+		histograms_[(int)FrameTimeMetric::GE].Add(sample.ge);
+		histograms_[(int)FrameTimeMetric::PRESENT_WAIT].Add(sample.presentWait);
+		histograms_[(int)FrameTimeMetric::VBLANK_LATE].Add(sample.vblankLate);
+		if (samples_.size() < MAX_RECORDED_SAMPLES)
+			samples_.push_back(sample);
+	}
+	lastFlip_ = now;
+	current_ = {};
+}
+
+void FrameTiming::NotifyLate(double late) {
+	if (!recording_)
+		return;
+	std::lock_guard<std::mutex> guard(recordLock_);
+	current_.vblankLate = std::max(current_.vblankLate, late);
+}
+
+void FrameTiming::NotifyWait(double t) {
+	if (!recording_)
+		return;
+	std::lock_guard<std::mutex> guard(recordLock_);
+	current_.presentWait += t;
+}
+
+int FrameTiming::RecordedFrames() {
+	std::lock_guard<std::mutex> guard(recordLock_);
+	return histograms_[(int)FrameTimeMetric::TOTAL].Count();
+}
+
+double FrameTiming::Percentile(FrameTimeMetric metric, double p) {
+	std::lock_guard<std::mutex> guard(recordLock_);
+	return histograms_[(int)metric].Percentile(p);
+}
+
+double FrameTiming::Max(FrameTimeMetric metric) {
+	std::lock_guard<std::mutex> guard(recordLock_);
+	return histograms_[(int)metric].Max();
+}
+
+bool FrameTiming::WriteCSV(const Path &filename) {
+	FILE *fp = File::OpenCFile(filename, "wb");
+	if (!fp) {
+		ERROR_LOG(Log::System, "Unable to open %s to write frame times", filename.c_str());
+		return false;
+	}
+
+	std::lock_guard<std::mutex> guard(recordLock_);
+	fprintf(fp, "frame,total_ms,cpu_ms,ge_ms,present_wait_ms,vblank_late_ms\n");
+	for (size_t i = 0; i < samples_.size(); ++i) {
+		const FrameTimeSample &sample = samples_[i];
+		fprintf(fp, "%d,%0.3f,%0.3f,%0.3f,%0.3f,%0.3f\n", (int)i, sample.Total() * 1000.0, sample.cpu * 1000.0, sample.ge * 1000.0, sample.presentWait * 1000.0, sample.vblankLate * 1000.0);
+	}
+	bool success = !ferror(fp);
+	fclose(fp);
+
+	INFO_LOG(Log::System, "Wrote %d frame times to %s", (int)samples_.size(), filename.c_str());
+	return success;
+}
+
 Draw::PresentMode ComputePresentMode(Draw::DrawContext *draw, int *interval) {
 	_assert_(draw);
 
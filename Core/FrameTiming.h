@@ -1,6 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <mutex>
+#include <vector>
+
 #include "Common/GPU/thin3d.h"
+#include "Common/Math/Statistics.h"
 
 // See big comment in the CPP file.
 
@@ -8,12 +13,56 @@ namespace Draw {
 class DrawContext;
 }
 
+class Path;
+
+// Where the time between two flips went, in seconds.
+struct FrameTimeSample {
+	// Everything else: the emulated CPU, HLE, and the host side of the frame.
+	double cpu;
+	// Processing GE display lists.
+	double ge;
+	// Sleeping to throttle, before or after submitting the frame.
+	double presentWait;
+	// How far past the ideal start of this frame we got to the flip.  Only counted when throttling.
+	double vblankLate;
+
+	double Total() const { return cpu + ge + presentWait; }
+};
+
+enum class FrameTimeMetric {
+	TOTAL,
+	CPU,
+	GE,
+	PRESENT_WAIT,
+	VBLANK_LATE,
+	COUNT,
+};
+
+const char *FrameTimeMetricToString(FrameTimeMetric metric);
+
 class FrameTiming {
 public:
 	void DeferWaitUntil(double until, double *curTimePtr);
 	void PostSubmit();
 	void Reset(Draw::DrawContext *draw);
 
+	// Per-frame recording, for percentiles.  This forces debug stats on, since that's what measures GE time.
+	// Starting again clears anything recorded so far.
+	void StartRecording();
+	void StopRecording();
+	bool IsRecording() const { return recording_; }
+
+	// Called on the emu thread when a frame is flipped, this finishes the previous frame's sample.
+	void NotifyFlip();
+	void NotifyLate(double late);
+	void NotifyWait(double t);
+
+	int RecordedFrames();
+	// p is 0.0 - 1.0.  Returns seconds.
+	double Percentile(FrameTimeMetric metric, double p);
+	double Max(FrameTimeMetric metric);
+	bool WriteCSV(const Path &filename);
+
 	// Some backends won't allow changing this willy nilly.
 	Draw::PresentMode presentMode;
 	int presentInterval;
@@ -21,6 +70,15 @@ class FrameTiming {
 private:
 	double waitUntil_;
 	double *curTimePtr_;
+
+	std::mutex recordLock_;
+	std::atomic<bool> recording_{};
+	double lastFlip_ = 0.0;
+	double lastGETime_ = 0.0;
+	FrameTimeSample current_{};
+	DurationHistogram histograms_[(int)FrameTimeMetric::COUNT];
+	// Capped, for the CSV.  The histograms keep counting past it.
+	std::vector<FrameTimeSample> samples_;
 };
 
 extern FrameTiming g_frameTiming;
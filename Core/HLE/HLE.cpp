@@ -23,6 +23,7 @@
 #include "Common/Math/CrossSIMD.h"
 
 #include "Common/Profiler/Profiler.h"
+#include "Common/Profiler/TraceRecorder.h"
 
 #include "Common/Log.h"
 #include "Common/Serialize/SerializeFuncs.h"
@@ -586,6 +587,10 @@ bool hleIsKernelMode() {
 	return g_stackSize && (g_stack[0]->flags & HLE_KERNEL_SYSCALL) != 0;
 }
 
+const char *hleGetCurrentSyscallName() {
+	return g_stackSize ? g_stack[0]->name : nullptr;
+}
+
 void hleEnqueueCall(u32 func, int argc, const u32 *argv, PSPAction *afterAction) {
 	std::vector<u32> args;
 	args.resize(argc);
@@ -935,6 +940,26 @@ void *GetQuickSyscallFunc(MIPSOpcode op) {
 	return (void *)&CallSyscallWithoutFlags;
 }
 
+const HLEFunction *GetDirectSyscallFunc(MIPSOpcode op) {
+	if (coreCollectDebugStats)
+		return nullptr;
+
+	const HLEFunction *info = GetSyscallFuncPointer(op);
+	if (!info || !info->func || info->flags != 0 || op == idleOp)
+		return nullptr;
+	return info;
+}
+
+const HLEDirectSyscallState &GetDirectSyscallState() {
+	static const HLEDirectSyscallState state = { g_stack, &g_stackSize, &g_syscallPC, &hleAfterSyscall };
+	return state;
+}
+
+void hleFinishDirectSyscall(const HLEFunction *info) {
+	hleFinishSyscall(info);
+	g_stackSize = 0;
+}
+
 void hleSetFlipTime(double t) {
 	hleFlipTime = t;
 }
@@ -954,6 +979,7 @@ void CallSyscall(MIPSOpcode op) {
 	}
 
 	if (info->func) {
+		TRACE_SCOPE("syscall", info->name);
 		if (op == idleOp)
 			info->func();
 		else if (info->flags != 0)
@@ -139,6 +139,8 @@ void hleSkipDeadbeef();
 void hleSetFlipTime(double t);
 // Check if the current syscall context is kernel.
 bool hleIsKernelMode();
+// Name of the syscall currently executing, or nullptr if not inside one.
+const char *hleGetCurrentSyscallName();
 // Enqueue a MIPS function to be called after this HLE call finishes.
 void hleEnqueueCall(u32 func, int argc, const u32 *argv, PSPAction *afterAction = nullptr);
 
@@ -186,6 +188,19 @@ const HLEFunction *GetSyscallFuncPointer(MIPSOpcode op);
 // For jit, takes arg: const HLEFunction *
 void *GetQuickSyscallFunc(MIPSOpcode op);
 
+// Addresses of the syscall bookkeeping, so jits can inline what CallSyscallWithoutFlags() does.
+struct HLEDirectSyscallState {
+	const HLEFunction **stack;
+	int *stackSize;
+	u32 *syscallPC;
+	int *afterSyscall;
+};
+const HLEDirectSyscallState &GetDirectSyscallState();
+// For jit, returns the function if it can be called directly (no flags), otherwise nullptr.
+const HLEFunction *GetDirectSyscallFunc(MIPSOpcode op);
+// For jit, call after a direct syscall if afterSyscall was non-zero.
+void hleFinishDirectSyscall(const HLEFunction *info);
+
 void hleDoLogInternal(Log t, LogLevel level, u64 res, const char *file, int line, const char *reportTag, const char *reason, const char *formatted_reason);
 
 template <bool leave, bool convert_code, typename T>
@@ -489,6 +489,109 @@ static int Replace_strncmp() {
 	return 10 + bytes / 4;  // approximation
 }
 
+static int Replace_memcmp() {
+	u32 aPtr = PARAM(0);
+	u32 bPtr = PARAM(1);
+	// A mismatch might come before the end of valid memory, the original would only crash after it.
+	u32 bytes = std::min(Memory::ValidSize(aPtr, PARAM(2)), Memory::ValidSize(bPtr, PARAM(2)));
+	const u8 *a = Memory::GetPointerRange(aPtr, bytes);
+	const u8 *b = Memory::GetPointerRange(bPtr, bytes);
+	int result = 0;
+	u32 offset = 0;
+	if (a && b && bytes != 0) {
+		// The PSP's libc returns the difference of the first mismatching bytes, not just the sign.
+		// Skip matching 8 byte chunks first, this is the common case for long compares.
+		while (offset + 8 <= bytes) {
+			u64 av, bv;
+			memcpy(&av, a + offset, 8);
+			memcpy(&bv, b + offset, 8);
+			if (av != bv)
+				break;
+			offset += 8;
+		}
+		while (offset < bytes && a[offset] == b[offset])
+			offset++;
+		if (offset < bytes)
+			result = (int)a[offset] - (int)b[offset];
+	}
+	RETURN(result);
+
+	if (MemBlockInfoDetailed(offset)) {
+		u32 readBytes = std::min(offset + 1, bytes);
+		NotifyMemInfo(MemBlockFlags::READ, aPtr, readBytes, "ReplaceMemcmp");
+		NotifyMemInfo(MemBlockFlags::READ, bPtr, readBytes, "ReplaceMemcmp");
+	}
+
+	return 10 + offset / 2;  // approximation
+}
+
+static int Replace_memchr() {
+	u32 srcPtr = PARAM(0);
+	// Games may pass a huge size when they know the byte is there, so only look in valid memory.
+	u32 bytes = Memory::ValidSize(srcPtr, PARAM(2));
+	const u8 *src = Memory::GetPointerRange(srcPtr, bytes);
+	u32 result = 0;
+	u32 len = bytes;
+	if (src && bytes != 0) {
+		const u8 *found = (const u8 *)memchr(src, (u8)PARAM(1), bytes);
+		if (found) {
+			len = (u32)(found - src);
+			result = srcPtr + len;
+		}
+	}
+	RETURN(result);
+
+	if (MemBlockInfoDetailed(len))
+		NotifyMemInfo(MemBlockFlags::READ, srcPtr, std::min(len + 1, bytes), "ReplaceMemchr");
+
+	return 10 + len;  // approximation
+}
+
+static int Replace_strchr() {
+	u32 srcPtr = PARAM(0);
+	char c = (char)PARAM(1);
+	u32 len = SafeStringLen(srcPtr);
+	const char *src = (const char *)Memory::GetPointerRange(srcPtr, len + 1);
+	u32 result = 0;
+	if (src) {
+		// Like strchr, searching for the terminator finds it.
+		const char *found = (const char *)memchr(src, c, len + 1);
+		if (found) {
+			len = (u32)(found - src);
+			result = srcPtr + len;
+		}
+	}
+	RETURN(result);
+
+	if (MemBlockInfoDetailed(len))
+		NotifyMemInfo(MemBlockFlags::READ, srcPtr, len + 1, "ReplaceStrchr");
+
+	return 10 + len * 2;  // approximation
+}
+
+static int Replace_strrchr() {
+	u32 srcPtr = PARAM(0);
+	char c = (char)PARAM(1);
+	u32 len = SafeStringLen(srcPtr);
+	const char *src = (const char *)Memory::GetPointerRange(srcPtr, len + 1);
+	u32 result = 0;
+	if (src) {
+		// Like strrchr, searching for the terminator finds it.
+		for (u32 i = len + 1; i > 0; --i) {
+			if (src[i - 1] == c) {
+				result = srcPtr + i - 1;
+				break;
+			}
+		}
+	}
+	RETURN(result);
+
+	if (MemBlockInfoDetailed(len))
+		NotifyMemInfo(MemBlockFlags::READ, srcPtr, len + 1, "ReplaceStrrchr");
+
+	return 10 + len * 3;  // approximation
+}
+
 static int Replace_fabsf() {
 	RETURNF(fabsf(PARAMF(0)));
 	return 4;
@@ -1519,6 +1622,12 @@ static const ReplacementTableEntry entries[] = {
 	{ "strncpy", &Replace_strncpy, 0, REPFLAG_DISABLED },
 	{ "strcmp", &Replace_strcmp, 0, REPFLAG_DISABLED },
 	{ "strncmp", &Replace_strncmp, 0, REPFLAG_DISABLED },
+	// Unlike strlen and friends, any function that behaves like these as C defines them returns the same
+	// values (memcmp callers can only rely on the sign), so whichever builtin hash matched is safe to replace.
+	{ "memcmp", &Replace_memcmp, 0, 0 },
+	{ "memchr", &Replace_memchr, 0, 0 },
+	{ "strchr", &Replace_strchr, 0, 0 },
+	{ "strrchr", &Replace_strrchr, 0, 0 },
 	{ "fabsf", &Replace_fabsf, JITFUNC(Replace_fabsf), REPFLAG_ALLOWINLINE | REPFLAG_DISABLED },
 	{ "dl_write_matrix", &Replace_dl_write_matrix, 0, REPFLAG_DISABLED }, // &MIPSComp::Jit::Replace_dl_write_matrix, REPFLAG_DISABLED },
 	{ "dl_write_matrix_2", &Replace_dl_write_matrix, 0, REPFLAG_DISABLED },
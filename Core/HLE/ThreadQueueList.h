@@ -18,13 +18,17 @@
 #pragma once
 
 #include "Core/HLE/sceKernel.h"
+#include "Common/BitSet.h"
 #include "Common/Serialize/Serializer.h"
+#include "Common/Serialize/SerializeFuncs.h"
 
 struct ThreadQueueList {
 	// Number of queues (number of priority levels starting at 0.)
 	static const int NUM_QUEUES = 128;
 	// Initial number of threads a single queue can handle.
 	static const int INITIAL_CAPACITY = 32;
+	// Number of u32 words in the non-empty bitmap.
+	static const int NUM_BITMAP_WORDS = NUM_QUEUES / 32;
 
 	struct Queue {
 		// Next ever-been-used queue (worse priority.)
@@ -51,6 +55,7 @@ struct ThreadQueueList {
 
 	ThreadQueueList() {
 		memset(queues, 0, sizeof(queues));
+		memset(nonEmpty, 0, sizeof(nonEmpty));
 		first = invalid();
 	}
 
@@ -75,37 +80,27 @@ struct ThreadQueueList {
 	}
 
 	inline SceUID pop_first() {
-		Queue *cur = first;
-		while (cur != invalid()) {
-			if (cur->size() > 0)
-				return cur->data[cur->first++];
-			cur = cur->next;
-		}
+		int priority = first_nonempty();
+		if (priority >= 0)
+			return pop_at(priority);
 
 		_dbg_assert_msg_(false, "ThreadQueueList should not be empty.");
 		return 0;
 	}
 
 	inline SceUID pop_first_better(u32 priority) {
-		Queue *cur = first;
 		// Don't bother looking past (worse than) this priority.
-		Queue *stop = &queues[priority];
-		while (cur < stop) {
-			if (cur->size() > 0)
-				return cur->data[cur->first++];
-			cur = cur->next;
-		}
+		int best = first_nonempty();
+		if (best >= 0 && best < (int)priority)
+			return pop_at(best);
 
 		return 0;
 	}
 
 	inline SceUID peek_first() {
-		Queue *cur = first;
-		while (cur != invalid()) {
-			if (cur->size() > 0)
-				return cur->data[cur->first];
-			cur = cur->next;
-		}
+		int priority = first_nonempty();
+		if (priority >= 0)
+			return queues[priority].data[queues[priority].first];
 
 		return 0;
 	}
@@ -113,6 +108,7 @@ struct ThreadQueueList {
 	inline void push_front(u32 priority, const SceUID threadID) {
 		Queue *cur = &queues[priority];
 		cur->data[--cur->first] = threadID;
+		mark_nonempty(priority);
 		// If we ran out of room toward the front, add more room for next time.
 		if (cur->first == 0)
 			rebalance(priority);
@@ -121,6 +117,7 @@ struct ThreadQueueList {
 	inline void push_back(u32 priority, const SceUID threadID) {
 		Queue *cur = &queues[priority];
 		cur->data[cur->end++] = threadID;
+		mark_nonempty(priority);
 		if (cur->full())
 			rebalance(priority);
 	}
@@ -139,6 +136,8 @@ struct ThreadQueueList {
 
 				// Now we're one shorter.
 				--cur->end;
+				if (cur->empty())
+					mark_empty(priority);
 				return;
 			}
 		}
@@ -163,6 +162,7 @@ struct ThreadQueueList {
 			free(queues[i].data);
 		}
 		memset(queues, 0, sizeof(queues));
+		memset(nonEmpty, 0, sizeof(nonEmpty));
 		first = invalid();
 	}
 
@@ -209,8 +209,11 @@ struct ThreadQueueList {
 				cur->end = cur->first + size;
 			}
 
-			if (size != 0)
+			if (size != 0) {
 				DoArray(p, &cur->data[cur->first], size);
+				if (p.mode == p.MODE_READ)
+					mark_nonempty(i);
+			}
 		}
 	}
 
@@ -219,6 +222,31 @@ struct ThreadQueueList {
 		return (Queue *)-1;
 	}
 
+	// Best (lowest) priority level with any threads, or -1 if all are empty.
+	inline int first_nonempty() const {
+		for (int w = 0; w < NUM_BITMAP_WORDS; ++w) {
+			if (nonEmpty[w] != 0)
+				return w * 32 + LeastSignificantSetBit(nonEmpty[w]);
+		}
+		return -1;
+	}
+
+	inline SceUID pop_at(int priority) {
+		Queue *cur = &queues[priority];
+		SceUID threadID = cur->data[cur->first++];
+		if (cur->empty())
+			mark_empty(priority);
+		return threadID;
+	}
+
+	inline void mark_nonempty(u32 priority) {
+		nonEmpty[priority >> 5] |= 1U << (priority & 31);
+	}
+
+	inline void mark_empty(u32 priority) {
+		nonEmpty[priority >> 5] &= ~(1U << (priority & 31));
+	}
+
 	// Initialize a priority level and link to other queues.
 	void link(u32 priority, int size) {
 		_dbg_assert_msg_(queues[priority].data == nullptr, "ThreadQueueList::Queue should only be initialized once.");
@@ -285,4 +313,6 @@ struct ThreadQueueList {
 	Queue *first;
 	// The priority level queues of thread ids.
 	Queue queues[NUM_QUEUES];
+	// One bit per priority level that currently has threads, lowest bit is the best priority.
+	u32 nonEmpty[NUM_BITMAP_WORDS];
 };
@@ -29,6 +29,7 @@
 
 #include "Common/Data/Text/I18n.h"
 #include "Common/Profiler/Profiler.h"
+#include "Common/Profiler/TraceRecorder.h"
 #include "Common/System/System.h"
 #include "Common/System/OSD.h"
 #include "Common/Serialize/Serializer.h"
@@ -419,6 +420,8 @@ static void DoFrameTiming(bool throttle, bool *skipFrame, float scaledTimestep,
 		nextFrameTime = std::max(lastFrameTime + scaledTimestep, time_now_d() - maxFallBehindFrames * scaledTimestep);
 	}
 	curFrameTime = time_now_d();
+	if (throttle)
+		g_frameTiming.NotifyLate(std::max(0.0, curFrameTime - nextFrameTime));
 
 	if (g_Config.bLogFrameDrops) {
 		DoFrameDropLogging(scaledTimestep);
@@ -452,7 +455,9 @@ static void DoFrameTiming(bool throttle, bool *skipFrame, float scaledTimestep,
 				g_frameTiming.DeferWaitUntil(nextFrameTime, &curFrameTime);
 			} else {
 				WaitUntil(curFrameTime, nextFrameTime, "display-wait");
+				double waitStart = curFrameTime;
 				curFrameTime = time_now_d();  // I guess we could also just set it to nextFrameTime...
+				g_frameTiming.NotifyWait(curFrameTime - waitStart);
 			}
 		}
 	}
@@ -501,6 +506,7 @@ static void DoFrameIdleTiming() {
 		if ((DebugOverlay)g_Config.iDebugOverlay == DebugOverlay::FRAME_GRAPH || coreCollectDebugStats) {
 			DisplayNotifySleep(time_now_d() - before);
 		}
+		g_frameTiming.NotifyWait(time_now_d() - before);
 	}
 }
 
@@ -571,6 +577,7 @@ static void NotifyUserIfSlow() {
 
 void __DisplayFlip(int cyclesLate) {
 	_dbg_assert_(gpu);
+	TraceRecorder_AddInstant("frame", "Flip");
 
 	__DisplaySetFramerate();
 
@@ -623,6 +630,7 @@ void __DisplayFlip(int cyclesLate) {
 	// Debugger integration
 	int frameSleepPos = DisplayGetSleepPos();
 	double frameSleepStart = time_now_d();
+	g_frameTiming.NotifyFlip();
 	DisplayFireFlip();
 
 	NotifyUserIfSlow();
@@ -497,6 +497,7 @@ void KernelObject::GetLongInfo(char *ptr, int size) const {
 
 KernelObjectPool::KernelObjectPool() {
 	memset(occupied, 0, sizeof(bool)*maxCount);
+	memset(typeIndex, 0, sizeof(typeIndex));
 	nextID = initialNextID;
 }
 
@@ -511,6 +512,7 @@ SceUID KernelObjectPool::Create(KernelObject *obj, int rangeBottom, int rangeTop
 			occupied[i] = true;
 			pool[i] = obj;
 			pool[i]->uid = i + handleOffset;
+			IndexAdd(i, obj->GetIDType());
 			return i + handleOffset;
 		}
 	}
@@ -527,6 +529,7 @@ void KernelObjectPool::Clear() {
 		pool[i] = nullptr;
 		occupied[i] = false;
 	}
+	memset(typeIndex, 0, sizeof(typeIndex));
 	nextID = initialNextID;
 }
 
@@ -593,6 +596,8 @@ void KernelObjectPool::DoState(PointerWrap &p) {
 			Do(p, type);
 		}
 		pool[i]->DoState(p);
+		if (p.mode == p.MODE_READ)
+			IndexAdd(i, pool[i]->GetIDType());
 		if (p.error >= p.ERROR_FAILURE)
 			break;
 	}
@@ -21,6 +21,7 @@
 #include <string>
 
 #include "Common/CommonTypes.h"
+#include "Common/BitSet.h"
 #include "Common/Log.h"
 #include "Common/Swap.h"
 
@@ -157,6 +158,7 @@ class KernelObjectPool {
 		u32 error;
 		if (Get<T>(handle, error)) {
 			int index = handle - handleOffset;
+			IndexRemove(index, pool[index]->GetIDType());
 			occupied[index] = false;
 			delete pool[index];
 			pool[index] = nullptr;
@@ -212,28 +214,37 @@ class KernelObjectPool {
 	template <typename T, typename F>
 	void Iterate(F func) {
 		int type = T::GetStaticIDType();
-		for (int i = 0; i < maxCount; i++) {
-			if (!occupied[i])
-				continue;
-			T *t = static_cast<T *>(pool[i]);
-			if (t->GetIDType() == type) {
-				if (!func(i + handleOffset, t))
-					break;
+		const u32 *bits = typeIndex[TypeBucket(type)];
+		for (int w = 0; w < typeIndexWords; w++) {
+			// Re-read the word after each call, func may create or destroy objects.
+			u32 mask = 0xFFFFFFFF;
+			while (u32 live = bits[w] & mask) {
+				int b = LeastSignificantSetBit(live);
+				mask = 0xFFFFFFFE << b;
+				int i = w * 32 + b;
+				T *t = static_cast<T *>(pool[i]);
+				if (t->GetIDType() == type) {
+					if (!func(i + handleOffset, t))
+						return;
+				}
 			}
 		}
 	}
 
 	int ListIDType(int type, SceUID_le *uids, int count) const {
 		int total = 0;
-		for (int i = 0; i < maxCount; i++) {
-			if (!occupied[i]) {
-				continue;
-			}
-			if (pool[i]->GetIDType() == type) {
-				if (total < count) {
-					*uids++ = pool[i]->GetUID();
+		const u32 *bits = typeIndex[TypeBucket(type)];
+		for (int w = 0; w < typeIndexWords; w++) {
+			u32 live = bits[w];
+			while (live != 0) {
+				int i = w * 32 + LeastSignificantSetBit(live);
+				live &= live - 1;
+				if (pool[i]->GetIDType() == type) {
+					if (total < count) {
+						*uids++ = pool[i]->GetUID();
+					}
+					++total;
 				}
-				++total;
 			}
 		}
 		return total;
@@ -259,8 +270,30 @@ class KernelObjectPool {
 		initialNextID = 0x10
 	};
 private:
+	enum {
+		typeIndexBuckets = 20,
+		typeIndexWords = maxCount / 32,
+	};
+
+	// Maps an object type to its slot in typeIndex.  Unusual types share bucket 0.
+	static int TypeBucket(int type) {
+		if (type >= SCE_KERNEL_TMID_Thread && type <= SCE_KERNEL_TMID_Tlspl)
+			return type;
+		if (type >= PPSSPP_KERNEL_TMID_Module && type <= PPSSPP_KERNEL_TMID_Heap)
+			return type - PPSSPP_KERNEL_TMID_Module + SCE_KERNEL_TMID_Tlspl + 1;
+		return 0;
+	}
+	void IndexAdd(int index, int type) {
+		typeIndex[TypeBucket(type)][index >> 5] |= 1U << (index & 31);
+	}
+	void IndexRemove(int index, int type) {
+		typeIndex[TypeBucket(type)][index >> 5] &= ~(1U << (index & 31));
+	}
+
 	KernelObject *pool[maxCount];
 	bool occupied[maxCount];
+	// One bit per slot for each object type, so Iterate/ListIDType only visit live objects of that type.
+	u32 typeIndex[typeIndexBuckets][typeIndexWords];
 	int nextID;
 };
 
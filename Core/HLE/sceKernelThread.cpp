@@ -2281,6 +2281,13 @@ u32 __KernelGetCurThreadStackStart() {
 	return 0;
 }
 
+u32 __KernelGetCurThreadEntry() {
+	PSPThread *t = __GetCurrentThread();
+	if (t)
+		return t->nt.entrypoint;
+	return 0;
+}
+
 SceUID sceKernelGetThreadId() {
 	hleEatCycles(180);
 	return hleLogVerbose(Log::sceKernel, currentThread);
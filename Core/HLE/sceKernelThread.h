@@ -297,6 +297,7 @@ int KernelCurThreadPriority();
 bool KernelChangeThreadPriority(SceUID threadID, int priority);
 u32 __KernelGetCurThreadStack();
 u32 __KernelGetCurThreadStackStart();
+u32 __KernelGetCurThreadEntry();
 const char *__KernelGetThreadName(SceUID threadID);
 bool KernelIsThreadDormant(SceUID threadID);
 bool KernelIsThreadWaiting(SceUID threadID);
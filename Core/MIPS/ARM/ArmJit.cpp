@@ -821,7 +821,7 @@ bool ArmJit::CheckJitBreakpoint(u32 addr, int downcountOffset) {
 }
 
 bool ArmJit::CheckMemoryBreakpoint(int instructionOffset) {
-	if (g_breakpoints.HasMemChecks()) {
+	if (g_breakpoints.HasJitMemChecks()) {
 		int off = instructionOffset + (js.inDelaySlot ? 1 : 0);
 
 		MRS(R8);
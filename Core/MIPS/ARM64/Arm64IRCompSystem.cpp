@@ -20,6 +20,7 @@
 #if PPSSPP_ARCH(ARM64) || (PPSSPP_PLATFORM(WINDOWS) && !defined(__LIBRETRO__))
 
 #include "Common/Profiler/Profiler.h"
+#include "Core/Config.h"
 #include "Core/Core.h"
 #include "Core/Debugger/Breakpoints.h"
 #include "Core/HLE/HLE.h"
@@ -202,6 +203,50 @@ void Arm64JitBackend::CompIR_Breakpoint(IRInst inst) {
 	}
 }
 
+void Arm64JitBackend::WriteDirectSyscall(const HLEFunction *info) {
+	const HLEDirectSyscallState &state = GetDirectSyscallState();
+
+	// This is CallSyscallWithoutFlags(), but calling info->func directly.
+	MOVP2R(SCRATCH1_64, state.stack);
+	MOVP2R(SCRATCH2_64, info);
+	STR(INDEX_UNSIGNED, SCRATCH2_64, SCRATCH1_64, 0);
+	MOVP2R(SCRATCH1_64, state.stackSize);
+	MOVI2R(SCRATCH2, 1);
+	STR(INDEX_UNSIGNED, SCRATCH2, SCRATCH1_64, 0);
+	LDR(INDEX_UNSIGNED, SCRATCH2, CTXREG, offsetof(MIPSState, pc));
+	MOVP2R(SCRATCH1_64, state.syscallPC);
+	STR(INDEX_UNSIGNED, SCRATCH2, SCRATCH1_64, 0);
+
+	QuickCallFunction(SCRATCH2_64, (const void *)info->func);
+
+	// Most syscalls don't request anything afterward, so just clear ll and fill deadbeef inline.
+	MOVP2R(SCRATCH1_64, state.afterSyscall);
+	LDR(INDEX_UNSIGNED, SCRATCH1, SCRATCH1_64, 0);
+	FixupBranch needsFinish = CBNZ(SCRATCH1);
+
+	STR(INDEX_UNSIGNED, WZR, CTXREG, IRREG_LLBIT * 4);
+	if (!g_Config.bSkipDeadbeefFilling) {
+		static const IRReg deadbeefRegs[] = {
+			MIPS_REG_COMPILER_SCRATCH,
+			MIPS_REG_A0, MIPS_REG_A1, MIPS_REG_A2, MIPS_REG_A3,
+			MIPS_REG_T0, MIPS_REG_T1, MIPS_REG_T2, MIPS_REG_T3,
+			MIPS_REG_T4, MIPS_REG_T5, MIPS_REG_T6, MIPS_REG_T7,
+			MIPS_REG_T8, MIPS_REG_T9, IRREG_LO, IRREG_HI,
+		};
+		MOVI2R(SCRATCH1, 0xDEADBEEF);
+		for (IRReg r : deadbeefRegs)
+			STR(INDEX_UNSIGNED, SCRATCH1, CTXREG, r * 4);
+	}
+	MOVP2R(SCRATCH1_64, state.stackSize);
+	STR(INDEX_UNSIGNED, WZR, SCRATCH1_64, 0);
+	FixupBranch skipFinish = B();
+
+	SetJumpTarget(needsFinish);
+	MOVP2R(X0, info);
+	QuickCallFunction(SCRATCH2_64, &hleFinishDirectSyscall);
+	SetJumpTarget(skipFinish);
+}
+
 void Arm64JitBackend::CompIR_System(IRInst inst) {
 	CONDITIONAL_DISABLE;
 
@@ -219,8 +264,11 @@ void Arm64JitBackend::CompIR_System(IRInst inst) {
 		// Skip the CallSyscall where possible.
 		{
 			MIPSOpcode op(inst.constant);
-			void *quickFunc = GetQuickSyscallFunc(op);
-			if (quickFunc) {
+			const HLEFunction *directFunc = GetDirectSyscallFunc(op);
+			void *quickFunc = directFunc ? nullptr : GetQuickSyscallFunc(op);
+			if (directFunc) {
+				WriteDirectSyscall(directFunc);
+			} else if (quickFunc) {
 				MOVP2R(X0, GetSyscallFuncPointer(op));
 				QuickCallFunction(SCRATCH2_64, (const u8 *)quickFunc);
 			} else {
@@ -30,6 +30,8 @@
 #include "Core/MIPS/JitCommon/JitCommon.h"
 #include "Core/MIPS/ARM64/Arm64IRRegCache.h"
 
+struct HLEFunction;
+
 namespace MIPSComp {
 
 class Arm64JitBackend : public Arm64Gen::ARM64CodeBlock, public IRNativeBackend {
@@ -62,6 +64,8 @@ class Arm64JitBackend : public Arm64Gen::ARM64CodeBlock, public IRNativeBackend
 	void WriteDebugPC(Arm64Gen::ARM64Reg r);
 	// Destroys SCRATCH2.
 	void WriteDebugProfilerStatus(IRProfilerStatus status);
+	// Destroys SCRATCH1 and SCRATCH2.
+	void WriteDirectSyscall(const HLEFunction *info);
 
 	void SaveStaticRegisters();
 	void LoadStaticRegisters();
@@ -54,6 +54,29 @@ using namespace MIPSAnalyst;
 namespace MIPSComp
 {
 
+// Loops back to the block start up to this size get a second iteration compiled inline.
+static const int MAX_UNROLL_LOOP_INSTRUCTIONS = 48;
+
+bool IRFrontend::TryUnrollLoop(u32 targetAddr, const BranchInfo &branchInfo) {
+	if (targetAddr != js.blockStart || unrolledLoop || js.hadBreakpoints)
+		return false;
+	if ((opts.disableFlags & (uint32_t)JitDisable::LOOP_UNROLL) != 0)
+		return false;
+	if (branchInfo.delaySlotIsBranch || js.numInstructions > MAX_UNROLL_LOOP_INSTRUCTIONS)
+		return false;
+	// The prefix state at the start of the block is assumed, so don't get creative with it.
+	if (js.MayHavePrefix())
+		return false;
+
+	// Instead of exiting, keep compiling from the block start.  The second iteration has its
+	// own downcount and exits, so this is equivalent to linking back, but the passes see both
+	// iterations and can reuse loads and constants from the first in the second.
+	unrolledLoop = true;
+	// DoJit will advance past the branch, landing on the block start.
+	js.compilerPC = targetAddr - 4;
+	return true;
+}
+
 void IRFrontend::BranchRSRTComp(MIPSOpcode op, IRComparison cc, bool likely) {
 	if (js.inDelaySlot) {
 		ERROR_LOG_REPORT(Log::JIT, "Branch in RSRTComp delay slot at %08x in block starting at %08x", GetCompilerPC(), js.blockStart);
@@ -114,6 +137,8 @@ void IRFrontend::BranchRSRTComp(MIPSOpcode op, IRComparison cc, bool likely) {
 	}
 
 	FlushAll();
+	if (TryUnrollLoop(targetAddr, branchInfo))
+		return;
 	ir.Write(IROp::ExitToConst, ir.AddConstant(targetAddr));
 
 	// Account for the delay slot.
@@ -165,6 +190,8 @@ void IRFrontend::BranchRSZeroComp(MIPSOpcode op, IRComparison cc, bool andLink,
 
 	// Taken
 	FlushAll();
+	if (TryUnrollLoop(targetAddr, branchInfo))
+		return;
 	ir.Write(IROp::ExitToConst, ir.AddConstant(targetAddr));
 
 	// Account for the delay slot.
@@ -244,6 +271,8 @@ void IRFrontend::BranchFPFlag(MIPSOpcode op, IRComparison cc, bool likely) {
 	}
 
 	FlushAll();
+	if (TryUnrollLoop(targetAddr, branchInfo))
+		return;
 	ir.Write(IROp::ExitToConst, ir.AddConstant(targetAddr));
 
 	// Account for the delay slot.
@@ -306,6 +335,8 @@ void IRFrontend::BranchVFPUFlag(MIPSOpcode op, IRComparison cc, bool likely) {
 
 	// Taken
 	FlushAll();
+	if (TryUnrollLoop(targetAddr, branchInfo))
+		return;
 	ir.Write(IROp::ExitToConst, ir.AddConstant(targetAddr));
 
 	// Account for the delay slot.
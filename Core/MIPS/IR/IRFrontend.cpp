@@ -22,6 +22,7 @@
 #include "Core/Debugger/SymbolMap.h"
 #include "Core/Reporting.h"
 #include "Core/HLE/ReplaceTables.h"
+#include "Core/MemFault.h"
 #include "Core/MemMap.h"
 #include "Core/MIPS/MIPSTables.h"
 #include "Core/MIPS/IR/IRFrontend.h"
@@ -252,6 +253,7 @@ void IRFrontend::DoJit(u32 em_address, std::vector<IRInst> &instructions, u32 &m
 	js.compiling = true;
 	js.hadBreakpoints = false;
 	js.blockWrotePrefixes = false;
+	unrolledLoop = false;
 	js.inDelaySlot = false;
 	js.PrefixStart();
 	ir.Clear();
@@ -283,6 +285,7 @@ void IRFrontend::DoJit(u32 em_address, std::vector<IRInst> &instructions, u32 &m
 			&RemoveLoadStoreLeftRight,
 			&OptimizeFPMoves,
 			&PropagateConstants,
+			&ReduceRedundantLoads,
 			&PurgeTemps,
 			&ReduceVec4Flush,
 			&OptimizeLoadsAfterStores,
@@ -387,7 +390,10 @@ void IRFrontend::CheckBreakpoint(u32 addr) {
 }
 
 void IRFrontend::CheckMemoryBreakpoint(int rs, int offset) {
-	if (g_breakpoints.HasMemChecks()) {
+	if (!g_breakpoints.HasJitMemChecks() && Memory::MemWatch_IsActive()) {
+		// Page protection catches these.  The native backend maps this, so a fault gets the exact PC.
+		ir.Write(IROp::SetPCConst, 0, ir.AddConstant(GetCompilerPC() + (js.inDelaySlot ? 4 : 0)));
+	} else if (g_breakpoints.HasJitMemChecks()) {
 		FlushAll();
 
 		// Can't skip this even at the start of a block, might impact block linking.
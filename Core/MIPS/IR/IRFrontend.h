@@ -120,6 +120,7 @@ class IRFrontend : public MIPSFrontendInterface {
 	void BranchVFPUFlag(MIPSOpcode op, IRComparison cc, bool likely);
 	void BranchRSZeroComp(MIPSOpcode op, IRComparison cc, bool andLink, bool likely);
 	void BranchRSRTComp(MIPSOpcode op, IRComparison cc, bool likely);
+	bool TryUnrollLoop(u32 targetAddr, const BranchInfo &branchInfo);
 
 	// Utilities to reduce duplicated code
 	void CompShiftImm(MIPSOpcode op, IROp shiftType, int sa);
@@ -141,6 +142,7 @@ class IRFrontend : public MIPSFrontendInterface {
 
 	int dontLogBlocks = 0;
 	int logBlocks = 0;
+	bool unrolledLoop = false;
 };
 
 }  // namespace
@@ -51,6 +51,8 @@ static const IRMeta irMeta[] = {
 	{ IROp::ShrImm, "ShrImm", "GGI" },
 	{ IROp::SarImm, "SarImm", "GGI" },
 	{ IROp::RorImm, "RorImm", "GGI" },
+	{ IROp::OptShlImmAdd, "OptShlImmAdd", "GGGc" },
+	{ IROp::OptShrImmAndConst, "OptShrImmAndConst", "GGIC" },
 	{ IROp::Slt, "Slt", "GGG" },
 	{ IROp::SltConst, "SltConst", "GGC" },
 	{ IROp::SltU, "SltU", "GGG" },
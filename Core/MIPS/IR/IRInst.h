@@ -55,6 +55,9 @@ enum class IROp : uint8_t {
 	ShrImm,
 	SarImm,
 	RorImm,
+	// Interpreter superinstructions: ShlImm + Add, and ShrImm + AndConst, in the same dest.
+	OptShlImmAdd,
+	OptShrImmAndConst,
 
 	Slt,
 	SltConst,
@@ -136,56 +136,96 @@ void IRRestoreRounding() {
 #endif
 }
 
+// With GCC and Clang, we dispatch through a table of label addresses (computed goto) instead of
+// going through the switch for every op. The compiler gives each handler its own copy of the
+// indirect jump, which the host branch predictor handles much better than the single one in the
+// switch. Only the ops listed below get a table entry, everything else still goes through the switch.
+#if defined(__GNUC__) && !defined(IR_NO_THREADED_DISPATCH)
+#define IR_THREADED_DISPATCH
+#endif
+
+#ifdef IR_THREADED_DISPATCH
+#define IR_CASE(op) case IROp::op: irop_##op:
+#else
+#define IR_CASE(op) case IROp::op:
+#endif
+
+#define IR_HOT_OPS(X) \
+	X(SetConst) X(SetConstF) X(Mov) X(Add) X(Sub) X(And) X(Or) X(Xor) X(AddConst) X(OptAddConst) \
+	X(SubConst) X(AndConst) X(OptAndConst) X(OrConst) X(OptOrConst) X(XorConst) X(Load8) X(Load8Ext) \
+	X(Load16) X(Load16Ext) X(Load32) X(LoadFloat) X(Store8) X(Store16) X(Store32) X(StoreFloat) \
+	X(LoadVec4) X(StoreVec4) X(Vec4Mov) X(Vec4Add) X(Vec4Mul) X(Vec4Scale) X(Vec4Dot) X(ShlImm) \
+	X(ShrImm) X(SarImm) X(OptShlImmAdd) X(OptShrImmAndConst) X(Slt) X(SltU) X(SltConst) X(SltUConst) \
+	X(MovZ) X(MovNZ) X(MfLo) X(MfHi) X(Mult) X(FAdd) X(FSub) X(FMul) X(FMov) X(FMovFromGPR) X(FMovToGPR) X(OptFCvtSWFromGPR) \
+	X(OptFMovToGPRShr8) X(ExitToConst) X(ExitToReg) X(ExitToConstIfEq) X(ExitToConstIfNeq) \
+	X(ExitToConstIfGtZ) X(ExitToConstIfGeZ) X(ExitToConstIfLtZ) X(ExitToConstIfLeZ) X(Downcount) \
+	X(SetPCConst)
+
 // We cannot use NEON on ARM32 here until we make it a hard dependency. We can, however, on ARM64.
 u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
+#ifdef IR_THREADED_DISPATCH
+	static const void *dispatchTable[256];
+	if (!dispatchTable[0]) {
+		for (int i = 0; i < 256; i++)
+			dispatchTable[i] = &&irop_switch;
+#define IR_DISPATCH_ENTRY(op) dispatchTable[(int)IROp::op] = &&irop_##op;
+		IR_HOT_OPS(IR_DISPATCH_ENTRY)
+#undef IR_DISPATCH_ENTRY
+	}
+#endif
+
 	while (true) {
+#ifdef IR_THREADED_DISPATCH
+		goto *dispatchTable[(int)inst->op];
+irop_switch:
+#endif
 		switch (inst->op) {
-		case IROp::SetConst:
+		IR_CASE(SetConst)
 			mips->r[inst->dest] = inst->constant;
 			break;
-		case IROp::SetConstF:
+		IR_CASE(SetConstF)
 			memcpy(&mips->f[inst->dest], &inst->constant, 4);
 			break;
-		case IROp::Add:
+		IR_CASE(Add)
 			mips->r[inst->dest] = mips->r[inst->src1] + mips->r[inst->src2];
 			break;
-		case IROp::Sub:
+		IR_CASE(Sub)
 			mips->r[inst->dest] = mips->r[inst->src1] - mips->r[inst->src2];
 			break;
-		case IROp::And:
+		IR_CASE(And)
 			mips->r[inst->dest] = mips->r[inst->src1] & mips->r[inst->src2];
 			break;
-		case IROp::Or:
+		IR_CASE(Or)
 			mips->r[inst->dest] = mips->r[inst->src1] | mips->r[inst->src2];
 			break;
-		case IROp::Xor:
+		IR_CASE(Xor)
 			mips->r[inst->dest] = mips->r[inst->src1] ^ mips->r[inst->src2];
 			break;
-		case IROp::Mov:
+		IR_CASE(Mov)
 			mips->r[inst->dest] = mips->r[inst->src1];
 			break;
-		case IROp::AddConst:
+		IR_CASE(AddConst)
 			mips->r[inst->dest] = mips->r[inst->src1] + inst->constant;
 			break;
-		case IROp::OptAddConst:  // For this one, it's worth having a "unary" variant of the above that only needs to read one register param.
+		IR_CASE(OptAddConst)  // For this one, it's worth having a "unary" variant of the above that only needs to read one register param.
 			mips->r[inst->dest] += inst->constant;
 			break;
-		case IROp::SubConst:
+		IR_CASE(SubConst)
 			mips->r[inst->dest] = mips->r[inst->src1] - inst->constant;
 			break;
-		case IROp::AndConst:
+		IR_CASE(AndConst)
 			mips->r[inst->dest] = mips->r[inst->src1] & inst->constant;
 			break;
-		case IROp::OptAndConst:  // For this one, it's worth having a "unary" variant of the above that only needs to read one register param.
+		IR_CASE(OptAndConst)  // For this one, it's worth having a "unary" variant of the above that only needs to read one register param.
 			mips->r[inst->dest] &= inst->constant;
 			break;
-		case IROp::OrConst:
+		IR_CASE(OrConst)
 			mips->r[inst->dest] = mips->r[inst->src1] | inst->constant;
 			break;
-		case IROp::OptOrConst:
+		IR_CASE(OptOrConst)
 			mips->r[inst->dest] |= inst->constant;
 			break;
-		case IROp::XorConst:
+		IR_CASE(XorConst)
 			mips->r[inst->dest] = mips->r[inst->src1] ^ inst->constant;
 			break;
 		case IROp::Neg:
@@ -204,19 +244,19 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			mips->r[inst->dest] = ReverseBits32(mips->r[inst->src1]);
 			break;
 
-		case IROp::Load8:
+		IR_CASE(Load8)
 			mips->r[inst->dest] = Memory::ReadUnchecked_U8(mips->r[inst->src1] + inst->constant);
 			break;
-		case IROp::Load8Ext:
+		IR_CASE(Load8Ext)
 			mips->r[inst->dest] = SignExtend8ToU32(Memory::ReadUnchecked_U8(mips->r[inst->src1] + inst->constant));
 			break;
-		case IROp::Load16:
+		IR_CASE(Load16)
 			mips->r[inst->dest] = Memory::ReadUnchecked_U16(mips->r[inst->src1] + inst->constant);
 			break;
-		case IROp::Load16Ext:
+		IR_CASE(Load16Ext)
 			mips->r[inst->dest] = SignExtend16ToU32(Memory::ReadUnchecked_U16(mips->r[inst->src1] + inst->constant));
 			break;
-		case IROp::Load32:
+		IR_CASE(Load32)
 			mips->r[inst->dest] = Memory::ReadUnchecked_U32(mips->r[inst->src1] + inst->constant);
 			break;
 		case IROp::Load32Left:
@@ -242,17 +282,17 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 				mips->r[inst->dest] = Memory::ReadUnchecked_U32(mips->r[inst->src1] + inst->constant);
 			mips->llBit = 1;
 			break;
-		case IROp::LoadFloat:
+		IR_CASE(LoadFloat)
 			mips->f[inst->dest] = Memory::ReadUnchecked_Float(mips->r[inst->src1] + inst->constant);
 			break;
 
-		case IROp::Store8:
+		IR_CASE(Store8)
 			Memory::WriteUnchecked_U8(mips->r[inst->src3], mips->r[inst->src1] + inst->constant);
 			break;
-		case IROp::Store16:
+		IR_CASE(Store16)
 			Memory::WriteUnchecked_U16(mips->r[inst->src3], mips->r[inst->src1] + inst->constant);
 			break;
-		case IROp::Store32:
+		IR_CASE(Store32)
 			Memory::WriteUnchecked_U32(mips->r[inst->src3], mips->r[inst->src1] + inst->constant);
 			break;
 		case IROp::Store32Left:
@@ -285,18 +325,18 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 				mips->r[inst->dest] = 0;
 			}
 			break;
-		case IROp::StoreFloat:
+		IR_CASE(StoreFloat)
 			Memory::WriteUnchecked_Float(mips->f[inst->src3], mips->r[inst->src1] + inst->constant);
 			break;
 
-		case IROp::LoadVec4:
+		IR_CASE(LoadVec4)
 		{
 			u32 base = mips->r[inst->src1] + inst->constant;
 			// This compiles to a nice SSE load/store on x86, and hopefully similar on ARM.
 			memcpy(&mips->f[inst->dest], Memory::GetPointerUnchecked(base), 4 * 4);
 			break;
 		}
-		case IROp::StoreVec4:
+		IR_CASE(StoreVec4)
 		{
 			u32 base = mips->r[inst->src1] + inst->constant;
 			memcpy((float *)Memory::GetPointerUnchecked(base), &mips->f[inst->dest], 4 * 4);
@@ -335,7 +375,7 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			break;
 		}
 
-		case IROp::Vec4Mov:
+		IR_CASE(Vec4Mov)
 		{
 #if defined(_M_SSE)
 			_mm_store_ps(&mips->f[inst->dest], _mm_load_ps(&mips->f[inst->src1]));
@@ -347,7 +387,7 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			break;
 		}
 
-		case IROp::Vec4Add:
+		IR_CASE(Vec4Add)
 		{
 #if defined(_M_SSE)
 			_mm_store_ps(&mips->f[inst->dest], _mm_add_ps(_mm_load_ps(&mips->f[inst->src1]), _mm_load_ps(&mips->f[inst->src2])));
@@ -373,7 +413,7 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			break;
 		}
 
-		case IROp::Vec4Mul:
+		IR_CASE(Vec4Mul)
 		{
 #if defined(_M_SSE)
 			_mm_store_ps(&mips->f[inst->dest], _mm_mul_ps(_mm_load_ps(&mips->f[inst->src1]), _mm_load_ps(&mips->f[inst->src2])));
@@ -399,7 +439,7 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			break;
 		}
 
-		case IROp::Vec4Scale:
+		IR_CASE(Vec4Scale)
 		{
 #if defined(_M_SSE)
 			_mm_store_ps(&mips->f[inst->dest], _mm_mul_ps(_mm_load_ps(&mips->f[inst->src1]), _mm_set1_ps(mips->f[inst->src2])));
@@ -621,7 +661,7 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			}
 			break;
 
-		case IROp::Vec4Dot:
+		IR_CASE(Vec4Dot)
 		{
 			// Not quickly implementable on all platforms, unfortunately.
 			// Though, this is still pretty fast compared to one split into multiple IR instructions.
@@ -649,13 +689,13 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			mips->f[inst->dest] = vfpu_asin(mips->f[inst->src1]);
 			break;
 
-		case IROp::ShlImm:
+		IR_CASE(ShlImm)
 			mips->r[inst->dest] = mips->r[inst->src1] << (int)inst->src2;
 			break;
-		case IROp::ShrImm:
+		IR_CASE(ShrImm)
 			mips->r[inst->dest] = mips->r[inst->src1] >> (int)inst->src2;
 			break;
-		case IROp::SarImm:
+		IR_CASE(SarImm)
 			mips->r[inst->dest] = (s32)mips->r[inst->src1] >> (int)inst->src2;
 			break;
 		case IROp::RorImm:
@@ -665,6 +705,12 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			mips->r[inst->dest] = (x >> sa) | (x << (32 - sa));
 		}
 		break;
+		IR_CASE(OptShlImmAdd)
+			mips->r[inst->dest] = (mips->r[inst->src1] << (int)inst->constant) + mips->r[inst->src2];
+			break;
+		IR_CASE(OptShrImmAndConst)
+			mips->r[inst->dest] = (mips->r[inst->src1] >> (int)inst->src2) & inst->constant;
+			break;
 
 		case IROp::Shl:
 			mips->r[inst->dest] = mips->r[inst->src1] << (mips->r[inst->src2] & 31);
@@ -689,27 +735,27 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			break;
 		}
 
-		case IROp::Slt:
+		IR_CASE(Slt)
 			mips->r[inst->dest] = (s32)mips->r[inst->src1] < (s32)mips->r[inst->src2];
 			break;
 
-		case IROp::SltU:
+		IR_CASE(SltU)
 			mips->r[inst->dest] = mips->r[inst->src1] < mips->r[inst->src2];
 			break;
 
-		case IROp::SltConst:
+		IR_CASE(SltConst)
 			mips->r[inst->dest] = (s32)mips->r[inst->src1] < (s32)inst->constant;
 			break;
 
-		case IROp::SltUConst:
+		IR_CASE(SltUConst)
 			mips->r[inst->dest] = mips->r[inst->src1] < inst->constant;
 			break;
 
-		case IROp::MovZ:
+		IR_CASE(MovZ)
 			if (mips->r[inst->src1] == 0)
 				mips->r[inst->dest] = mips->r[inst->src2];
 			break;
-		case IROp::MovNZ:
+		IR_CASE(MovNZ)
 			if (mips->r[inst->src1] != 0)
 				mips->r[inst->dest] = mips->r[inst->src2];
 			break;
@@ -727,14 +773,14 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 		case IROp::MtHi:
 			mips->hi = mips->r[inst->src1];
 			break;
-		case IROp::MfLo:
+		IR_CASE(MfLo)
 			mips->r[inst->dest] = mips->lo;
 			break;
-		case IROp::MfHi:
+		IR_CASE(MfHi)
 			mips->r[inst->dest] = mips->hi;
 			break;
 
-		case IROp::Mult:
+		IR_CASE(Mult)
 		{
 			s64 result = (s64)(s32)mips->r[inst->src1] * (s64)(s32)mips->r[inst->src2];
 			memcpy(&mips->lo, &result, 8);
@@ -822,13 +868,13 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			break;
 		}
 
-		case IROp::FAdd:
+		IR_CASE(FAdd)
 			mips->f[inst->dest] = mips->f[inst->src1] + mips->f[inst->src2];
 			break;
-		case IROp::FSub:
+		IR_CASE(FSub)
 			mips->f[inst->dest] = mips->f[inst->src1] - mips->f[inst->src2];
 			break;
-		case IROp::FMul:
+		IR_CASE(FMul)
 #if 1
 		{
 			float a = mips->f[inst->src1];
@@ -882,7 +928,7 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			}
 			break;
 
-		case IROp::FMov:
+		IR_CASE(FMov)
 			mips->f[inst->dest] = mips->f[inst->src1];
 			break;
 		case IROp::FAbs:
@@ -1071,16 +1117,16 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			break;
 		}
 
-		case IROp::FMovFromGPR:
+		IR_CASE(FMovFromGPR)
 			memcpy(&mips->f[inst->dest], &mips->r[inst->src1], 4);
 			break;
-		case IROp::OptFCvtSWFromGPR:
+		IR_CASE(OptFCvtSWFromGPR)
 			mips->f[inst->dest] = (float)(int)mips->r[inst->src1];
 			break;
-		case IROp::FMovToGPR:
+		IR_CASE(FMovToGPR)
 			memcpy(&mips->r[inst->dest], &mips->f[inst->src1], 4);
 			break;
-		case IROp::OptFMovToGPRShr8:
+		IR_CASE(OptFMovToGPRShr8)
 		{
 			u32 temp;
 			memcpy(&temp, &mips->f[inst->src1], 4);
@@ -1088,38 +1134,38 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			break;
 		}
 
-		case IROp::ExitToConst:
+		IR_CASE(ExitToConst)
 			return inst->constant;
 
-		case IROp::ExitToReg:
+		IR_CASE(ExitToReg)
 			return mips->r[inst->src1];
 
-		case IROp::ExitToConstIfEq:
+		IR_CASE(ExitToConstIfEq)
 			if (mips->r[inst->src1] == mips->r[inst->src2])
 				return inst->constant;
 			break;
-		case IROp::ExitToConstIfNeq:
+		IR_CASE(ExitToConstIfNeq)
 			if (mips->r[inst->src1] != mips->r[inst->src2])
 				return inst->constant;
 			break;
-		case IROp::ExitToConstIfGtZ:
+		IR_CASE(ExitToConstIfGtZ)
 			if ((s32)mips->r[inst->src1] > 0)
 				return inst->constant;
 			break;
-		case IROp::ExitToConstIfGeZ:
+		IR_CASE(ExitToConstIfGeZ)
 			if ((s32)mips->r[inst->src1] >= 0)
 				return inst->constant;
 			break;
-		case IROp::ExitToConstIfLtZ:
+		IR_CASE(ExitToConstIfLtZ)
 			if ((s32)mips->r[inst->src1] < 0)
 				return inst->constant;
 			break;
-		case IROp::ExitToConstIfLeZ:
+		IR_CASE(ExitToConstIfLeZ)
 			if ((s32)mips->r[inst->src1] <= 0)
 				return inst->constant;
 			break;
 
-		case IROp::Downcount:
+		IR_CASE(Downcount)
 			mips->downcount -= (int)inst->constant;
 			break;
 
@@ -1127,7 +1173,7 @@ u32 IRInterpret(MIPSState *mips, const IRInst *inst) {
 			mips->pc = mips->r[inst->src1];
 			break;
 
-		case IROp::SetPCConst:
+		IR_CASE(SetPCConst)
 			mips->pc = inst->constant;
 			break;
 
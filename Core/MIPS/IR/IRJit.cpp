@@ -21,6 +21,7 @@
 
 #include "ext/xxhash.h"
 #include "Common/Profiler/Profiler.h"
+#include "Common/Profiler/TraceRecorder.h"
 
 #include "Common/Log.h"
 #include "Common/Serialize/Serializer.h"
@@ -115,6 +116,7 @@ void IRJit::Compile(u32 em_address) {
 	_dbg_assert_(compilerEnabled_);
 
 	PROFILE_THIS_SCOPE("jitc");
+	TRACE_SCOPE("jit", "Compile");
 
 	if (g_Config.bPreloadFunctions) {
 		// Look to see if we've preloaded this block.
@@ -135,10 +137,13 @@ void IRJit::Compile(u32 em_address) {
 	std::vector<IRInst> instructions;
 	u32 mipsBytes;
 	if (!CompileBlock(em_address, instructions, mipsBytes, false)) {
-		// Ran out of block numbers - need to reset.
-		ERROR_LOG(Log::JIT, "Ran out of block numbers, clearing cache");
-		ClearCache();
-		CompileBlock(em_address, instructions, mipsBytes, false);
+		// Ran out of block numbers or code space.  Try to keep the recent blocks first.
+		bool compacted = CompactCache();
+		if (!compacted || !CompileBlock(em_address, instructions, mipsBytes, false)) {
+			ERROR_LOG(Log::JIT, "Ran out of block numbers, clearing cache");
+			ClearCache();
+			CompileBlock(em_address, instructions, mipsBytes, false);
+		}
 	}
 
 	if (frontend_.CheckRounding(em_address)) {
@@ -241,6 +241,8 @@ class IRJit : public JitInterface {
 	bool CompileBlock(u32 em_address, std::vector<IRInst> &instructions, u32 &mipsBytes, bool preload);
 	virtual bool CompileNativeBlock(IRBlockCache *irBlockCache, int block_num, bool preload) { return true; }
 	virtual void FinalizeNativeBlock(IRBlockCache *irBlockCache, int block_num) {}
+	// Frees up space without throwing away every block.  Returns false if a full clear is needed.
+	virtual bool CompactCache() { return false; }
 
 	bool compileToNative_;
 
@@ -18,11 +18,13 @@
 #include <atomic>
 #include <climits>
 #include <thread>
+#include <unordered_set>
 #include "Common/Profiler/Profiler.h"
 #include "Common/StringUtils.h"
 #include "Common/TimeUtil.h"
 #include "Core/Core.h"
 #include "Core/Debugger/SymbolMap.h"
+#include "Core/MemFault.h"
 #include "Core/MemMap.h"
 #include "Core/MIPS/MIPSTables.h"
 #include "Core/MIPS/IR/IRNativeCommon.h"
@@ -195,11 +197,16 @@ void IRNativeBackend::CompileIRInst(IRInst inst) {
 	case IROp::Nop:
 		break;
 
+	case IROp::SetPCConst:
+		if (Memory::MemWatch_IsActive())
+			Memory::MemWatch_MapCode(CodeBlock().GetCodePtr(), inst.constant);
+		CompIR_Basic(inst);
+		break;
+
 	case IROp::SetConst:
 	case IROp::SetConstF:
 	case IROp::Downcount:
 	case IROp::SetPC:
-	case IROp::SetPCConst:
 		CompIR_Basic(inst);
 		break;
 
@@ -515,6 +522,94 @@ void IRNativeJit::FinalizeNativeBlock(IRBlockCache *irblockCache, int block_num)
 	backend_->FinalizeBlock(irblockCache, block_num, jo);
 }
 
+// Native code can't simply be moved down, since exits are linked with absolute targets and
+// relative jumps into the fixed code.  Instead, we keep the IR of the most recently compiled
+// blocks, which are the most likely to still be running, wipe the code space, and emit them
+// again.  That skips the frontend and IR passes, and avoids a burst of recompiles right after.
+bool IRNativeJit::CompactCache() {
+	struct RetainedBlock {
+		u32 addr;
+		u32 size;
+		bool preload;
+		std::vector<IRInst> instructions;
+	};
+
+	const CodeBlockCommon &codeBlock = backend_->CodeBlock();
+	int endOffset = (int)codeBlock.GetOffset(codeBlock.GetCodePtr());
+	int firstOffset = endOffset;
+	for (int i = 0; i < blocks_.GetNumBlocks(); ++i) {
+		int offset = blocks_.GetBlock(i)->GetNativeOffset();
+		if (offset >= 0) {
+			firstOffset = offset;
+			break;
+		}
+	}
+	// Keep at most half of the used space, so we don't come right back here.
+	int budget = (endOffset - firstOffset) / 2;
+
+	// Walk backwards, since blocks are allocated linearly in the code space.
+	std::vector<RetainedBlock> retained;
+	std::unordered_set<u32> retainedAddrs;
+	int nextOffset = endOffset;
+	for (int i = blocks_.GetNumBlocks() - 1; i >= 0; --i) {
+		const IRBlock *block = blocks_.GetBlock(i);
+		int offset = block->GetNativeOffset();
+		if (offset < 0 || offset > nextOffset)
+			continue;
+		int size = nextOffset - offset;
+		nextOffset = offset;
+
+		// Invalidated blocks take up space, but their code may have changed.  A live block still
+		// has its own emuhack at the start.  Otherwise, the game overwrote it (or another block
+		// at the same address replaced it), and finalizing it again would clobber the new code.
+		u32 addr = block->GetOriginalStart();
+		bool live = addr != 0 && Memory::ReadUnchecked_U32(addr) == (MIPS_EMUHACK_OPCODE | (u32)offset);
+		// Preloaded blocks were never finalized, so only keep them while the code is unchanged.
+		bool preload = !live && addr != 0 && !block->IsValid() && block->HashMatches();
+		if (!live && !preload)
+			continue;
+		// Newer blocks come first, skip older ones at the same address.
+		if (!retainedAddrs.insert(addr).second)
+			continue;
+		if (size > budget)
+			break;
+		budget -= size;
+
+		RetainedBlock saved;
+		block->GetRange(&saved.addr, &saved.size);
+		saved.preload = preload;
+		const IRInst *instructions = blocks_.GetBlockInstructionPtr(*block);
+		saved.instructions.assign(instructions, instructions + block->GetNumIRInstructions());
+		retained.push_back(std::move(saved));
+	}
+
+	if (retained.empty())
+		return false;
+
+	int oldBlocks = blocks_.GetNumBlocks();
+	// This restores all the original ops, so the retained blocks can be finalized as new.
+	ClearCache();
+
+	for (auto it = retained.rbegin(); it != retained.rend(); ++it) {
+		int block_num = blocks_.AllocateBlock(it->addr, it->size, it->instructions);
+		if ((block_num & ~MIPS_EMUHACK_VALUE_MASK) != 0 || !CompileNativeBlock(&blocks_, block_num, it->preload)) {
+			WARN_LOG(Log::JIT, "Failed to recompile retained block at %08x", it->addr);
+			ClearCache();
+			return false;
+		}
+
+		// Same as IRJit::CompileBlock(), preloaded blocks get finalized once they're used.
+		if (it->preload)
+			blocks_.GetBlock(block_num)->UpdateHash();
+		blocks_.FinalizeBlock(block_num, it->preload);
+		if (!it->preload)
+			FinalizeNativeBlock(&blocks_, block_num);
+	}
+
+	INFO_LOG(Log::JIT, "Compacted jit cache, kept %d of %d blocks", (int)retained.size(), oldBlocks);
+	return true;
+}
+
 void IRNativeJit::RunLoopUntil(u64 globalticks) {
 	if constexpr (enableDebugStats || enableDebugProfiler) {
 		LogDebugStats();
@@ -200,6 +200,7 @@ class IRNativeJit : public IRJit {
 	void Init(IRNativeBackend &backend);
 	bool CompileNativeBlock(IRBlockCache *irBlockCache, int block_num, bool preload) override;
 	void FinalizeNativeBlock(IRBlockCache *irBlockCache, int block_num) override;
+	bool CompactCache() override;
 
 	IRNativeBackend *backend_ = nullptr;
 	IRNativeHooks hooks_;
@@ -2225,6 +2225,139 @@ bool OptimizeLoadsAfterStores(const IRWriter &in, IRWriter &out, const IROptions
 	return logBlocks;
 }
 
+// Reuses a value loaded earlier in the block, when neither the address nor the memory could have changed.
+// This mostly matters for loops unrolled by the frontend, where the second iteration reloads invariants.
+bool ReduceRedundantLoads(const IRWriter &in, IRWriter &out, const IROptions &opts) {
+	CONDITIONAL_DISABLE;
+
+	struct AvailableLoad {
+		IROp op;
+		IRReg base;
+		s32 offset;
+		IRReg dest;
+	};
+	std::vector<AvailableLoad> loads;
+
+	auto accessSize = [](IROp op) -> s32 {
+		switch (op) {
+		case IROp::Load8:
+		case IROp::Load8Ext:
+		case IROp::Store8:
+			return 1;
+		case IROp::Load16:
+		case IROp::Load16Ext:
+		case IROp::Store16:
+			return 2;
+		case IROp::StoreVec4:
+			return 16;
+		default:
+			return 4;
+		}
+	};
+
+	auto forgetReg = [&](IRReg reg) {
+		loads.erase(std::remove_if(loads.begin(), loads.end(), [&](const AvailableLoad &l) {
+			return l.base == reg || l.dest == reg;
+		}), loads.end());
+	};
+
+	auto forgetAliases = [&](const IRInst &store) {
+		s32 start = (s32)store.constant;
+		s32 end = start + accessSize(store.op);
+		if (store.op == IROp::Store32Left || store.op == IROp::Store32Right) {
+			// These write a partial word on either side of the address, just be conservative.
+			start -= 3;
+			end += 3;
+		}
+		loads.erase(std::remove_if(loads.begin(), loads.end(), [&](const AvailableLoad &l) {
+			// Only a nearby offset off the same (unchanged) base register is known not to alias.
+			if (l.base != store.src1)
+				return true;
+			// After constant propagation, zero-base addresses are absolute and may hit a mirror of
+			// the load (0x08/0x48/0x88 RAM, VRAM mirrors), so any zero-base store forgets them all.
+			// Likewise offsets too far apart for a single immediate could be mirrors.
+			if (store.src1 == MIPS_REG_ZERO || l.offset - start >= 0x10000 || start - l.offset >= 0x10000)
+				return true;
+			return l.offset < end && start < l.offset + accessSize(l.op);
+		}), loads.end());
+	};
+
+	bool logBlocks = false;
+	for (const IRInst &inst : in.GetInstructions()) {
+		const IRInstMeta meta = GetIRMeta(inst);
+		switch (inst.op) {
+		case IROp::Load8:
+		case IROp::Load8Ext:
+		case IROp::Load16:
+		case IROp::Load16Ext:
+		case IROp::Load32:
+		{
+			if (inst.dest == MIPS_REG_ZERO) {
+				out.Write(inst);
+				break;
+			}
+
+			auto it = std::find_if(loads.begin(), loads.end(), [&](const AvailableLoad &l) {
+				return l.op == inst.op && l.base == inst.src1 && l.offset == (s32)inst.constant;
+			});
+			if (it != loads.end() && it->dest == inst.dest) {
+				// Already holds the value, drop the load.
+				break;
+			}
+
+			if (it != loads.end()) {
+				out.Write(IROp::Mov, inst.dest, it->dest);
+			} else {
+				out.Write(inst);
+			}
+			forgetReg(inst.dest);
+			if (inst.src1 != inst.dest)
+				loads.push_back(AvailableLoad{ inst.op, inst.src1, (s32)inst.constant, inst.dest });
+			break;
+		}
+
+		case IROp::Store8:
+		case IROp::Store16:
+		case IROp::Store32:
+		case IROp::Store32Left:
+		case IROp::Store32Right:
+		case IROp::Store32Conditional:
+		case IROp::StoreFloat:
+		case IROp::StoreVec4:
+			forgetAliases(inst);
+			if (inst.op == IROp::Store32Conditional)
+				forgetReg(inst.dest);
+			out.Write(inst);
+			break;
+
+		case IROp::ExitToConstIfEq:
+		case IROp::ExitToConstIfNeq:
+		case IROp::ExitToConstIfGtZ:
+		case IROp::ExitToConstIfGeZ:
+		case IROp::ExitToConstIfLtZ:
+		case IROp::ExitToConstIfLeZ:
+		case IROp::ExitToConstIfFpTrue:
+		case IROp::ExitToConstIfFpFalse:
+			// If we didn't exit, everything is still valid.
+			out.Write(inst);
+			break;
+
+		default:
+			if ((meta.m.flags & (IRFLAG_EXIT | IRFLAG_BARRIER)) != 0) {
+				loads.clear();
+			} else {
+				int dest = IRDestGPR(meta);
+				if (dest >= 0)
+					forgetReg((IRReg)dest);
+			}
+			out.Write(inst);
+			break;
+		}
+	}
+
+	return logBlocks;
+}
+
 bool OptimizeForInterpreter(const IRWriter &in, IRWriter &out, const IROptions &opts) {
 	CONDITIONAL_DISABLE;
 	// This tells us to skip an AND op that has been optimized out.
@@ -2271,6 +2404,31 @@ bool OptimizeForInterpreter(const IRWriter &in, IRWriter &out, const IROptions &
 			}
 			out.Write(inst);
 			break;
+		case IROp::ShlImm:
+			if (!last) {
+				IRInst next = in.GetInstructions()[i + 1];
+				// Array indexing: x = (i << n) + base.
+				if (next.op == IROp::Add && next.dest == inst.dest && (next.src1 == inst.dest) != (next.src2 == inst.dest)) {
+					inst.op = IROp::OptShlImmAdd;
+					inst.constant = inst.src2;
+					inst.src2 = next.src1 == inst.dest ? next.src2 : next.src1;
+					i++;
+				}
+			}
+			out.Write(inst);
+			break;
+		case IROp::ShrImm:
+			if (!last) {
+				IRInst next = in.GetInstructions()[i + 1];
+				// Bitfield extraction: x = (y >> n) & mask.
+				if (next.op == IROp::AndConst && next.dest == inst.dest && next.src1 == inst.dest) {
+					inst.op = IROp::OptShrImmAndConst;
+					inst.constant = next.constant;
+					i++;
+				}
+			}
+			out.Write(inst);
+			break;
 		case IROp::FMovToGPR:
 			if (!last) {
 				IRInst next = in.GetInstructions()[i + 1];
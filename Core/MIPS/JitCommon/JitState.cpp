@@ -29,6 +29,7 @@ namespace MIPSComp {
 		enableVFPUSIMD = !Disabled(JitDisable::SIMD);
 		// Set by Asm if needed.
 		reserveR15ForAsm = false;
+		fuseVec4FMA = g_Config.bJitFuseFMA;
 
 		// ARM/ARM64
 		useBackJump = false;
@@ -60,8 +61,10 @@ namespace MIPSComp {
 
 		useStaticAlloc = false;
 		enablePointerify = false;
-#if PPSSPP_ARCH(ARM64) || PPSSPP_ARCH(RISCV64)
+#if PPSSPP_ARCH(ARM64) || PPSSPP_ARCH(RISCV64) || PPSSPP_ARCH(AMD64)
 		useStaticAlloc = !Disabled(JitDisable::STATIC_ALLOC);
+#endif
+#if PPSSPP_ARCH(ARM64) || PPSSPP_ARCH(RISCV64)
 		// iOS/etc. may disable at runtime if Memory::base is not nicely aligned.
 		enablePointerify = !Disabled(JitDisable::POINTERIFY);
 #endif
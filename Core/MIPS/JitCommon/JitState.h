@@ -199,6 +199,7 @@ namespace MIPSComp {
 		LSU_UNALIGNED = 0x2000,
 		LSU_FPU = 0x4000,
 		LSU_VFPU = 0x8000,
+		LOOP_UNROLL = 0x00010000,
 
 		SIMD = 0x00100000,
 		BLOCKLINK = 0x00200000,
@@ -224,6 +225,7 @@ namespace MIPSComp {
 		// x86
 		bool enableVFPUSIMD;
 		bool reserveR15ForAsm;
+		bool fuseVec4FMA;
 
 		// ARM/ARM64
 		bool useBackJump;
@@ -29,6 +29,7 @@
 #include "Common/StringUtils.h"
 #include "Common/TimeUtil.h"
 #include "Core/Config.h"
+#include "Core/ELF/ParamSFO.h"
 #include "Core/MemMap.h"
 #include "Core/System.h"
 #include "Core/MIPS/MIPS.h"
@@ -36,6 +37,7 @@
 #include "Core/MIPS/MIPSTables.h"
 #include "Core/MIPS/MIPSAnalyst.h"
 #include "Core/MIPS/MIPSCodeUtils.h"
+#include "Core/MIPS/JitCommon/JitBlockCache.h"
 #include "Core/Debugger/SymbolMap.h"
 #include "Core/Debugger/DebugInterface.h"
 #include "Core/HLE/ReplaceTables.h"
@@ -1351,6 +1353,105 @@ namespace MIPSAnalyst {
 		fclose(file);
 	}
 
+	std::vector<HotFunction> FindHotFunctions(const JitBlockCacheDebugInterface *blockCache, size_t maxCount) {
+		std::vector<HotFunction> hot;
+		if (!blockCache || !blockCache->SupportsProfiling())
+			return hot;
+
+		std::vector<HotFunction> sorted;
+		{
+			std::lock_guard<std::recursive_mutex> guard(functions_lock);
+			sorted.reserve(functions.size());
+			for (const AnalyzedFunction &f : functions) {
+				sorted.push_back(HotFunction{ f.start, f.size, f.hash, f.hasHash, false, 0, 0 });
+			}
+		}
+		std::sort(sorted.begin(), sorted.end(), [](const HotFunction &a, const HotFunction &b) {
+			return a.start < b.start;
+		});
+
+		int numBlocks = blockCache->GetNumBlocks();
+		for (int i = 0; i < numBlocks; ++i) {
+			if (!blockCache->IsValidBlock(i))
+				continue;
+			JitBlockMeta meta = blockCache->GetBlockMeta(i);
+			JitBlockProfileStats stats = blockCache->GetBlockProfileStats(i);
+			if (!meta.valid || stats.executions == 0)
+				continue;
+
+			auto it = std::upper_bound(sorted.begin(), sorted.end(), meta.addr, [](u32 addr, const HotFunction &f) {
+				return addr < f.start;
+			});
+			if (it == sorted.begin())
+				continue;
+			--it;
+			if (meta.addr >= it->start + it->size)
+				continue;
+			if (meta.addr == it->start)
+				it->calls += stats.executions;
+			it->totalNanos += stats.totalNanos;
+		}
+
+		for (HotFunction &f : sorted) {
+			if (f.totalNanos != 0)
+				hot.push_back(f);
+		}
+		std::sort(hot.begin(), hot.end(), [](const HotFunction &a, const HotFunction &b) {
+			return a.totalNanos > b.totalNanos;
+		});
+		if (hot.size() > maxCount)
+			hot.resize(maxCount);
+
+		for (HotFunction &f : hot) {
+			f.name = g_symbolMap->GetLabelString(f.start);
+			f.hasReplacement = f.hasHash && !GetReplacementFuncIndexes(f.hash, f.size).empty();
+		}
+		return hot;
+	}
+
+	bool StoreHotFunctionReport(const Path &filename, const JitBlockCacheDebugInterface *blockCache, size_t maxCount) {
+		std::vector<HotFunction> hot = FindHotFunctions(blockCache, maxCount);
+		if (hot.empty()) {
+			WARN_LOG(Log::JIT, "No profile data for hot functions, requires IR_PROFILING");
+			return false;
+		}
+
+		FILE *file = File::OpenCFile(filename, "wt");
+		if (!file) {
+			WARN_LOG(Log::JIT, "Could not store hot function report: %s", filename.c_str());
+			return false;
+		}
+
+		int64_t sumNanos = 0;
+		for (int i = 0; i < blockCache->GetNumBlocks(); ++i) {
+			if (blockCache->IsValidBlock(i))
+				sumNanos += blockCache->GetBlockProfileStats(i).totalNanos;
+		}
+
+		// Uses the knownfuncs.ini format so lines can be copied over and renamed.  Functions without a
+		// real name are commented out, since default names aren't useful in the hash map.
+		fprintf(file, "# Hottest %d functions for %s, by time spent.\n", (int)hot.size(), g_paramSFO.GetDiscID().c_str());
+		fprintf(file, "# Lines marked (replaced) already run natively.  To try an existing replacement on another function,\n");
+		fprintf(file, "# enable FuncHashMap under [Debugger] in ppsspp.ini, then copy its line to knownfuncs.ini and\n");
+		fprintf(file, "# rename it to the replacement (only enabled entries in Core/HLE/ReplaceTables.cpp apply).\n");
+		fprintf(file, "# New replacements need code, and a hash in MIPSAnalyst.cpp to apply for everyone.\n");
+		for (const HotFunction &f : hot) {
+			fprintf(file, "# %6.2f%%  %8.3f ms  %10lld calls  %08x  size %d%s\n",
+				sumNanos != 0 ? 100.0 * (double)f.totalNanos / (double)sumNanos : 0.0,
+				(double)f.totalNanos / 1000000.0, (long long)f.calls, f.start, f.size,
+				f.hasReplacement ? "  (replaced)" : "");
+			if (f.hasHash) {
+				bool defaultName = f.name.empty() || IsDefaultFunction(f.name);
+				fprintf(file, "%s%016llx:%d = %s\n", defaultName ? "# " : "", (unsigned long long)f.hash, f.size, f.name.c_str());
+			}
+		}
+		bool success = ferror(file) == 0;
+		fclose(file);
+
+		INFO_LOG(Log::JIT, "Wrote %d hot functions to %s", (int)hot.size(), filename.c_str());
+		return success;
+	}
+
 	void ApplyHashMap() {
 		UpdateHashToFunctionMap();
 
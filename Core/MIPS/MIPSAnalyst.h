@@ -25,6 +25,8 @@
 #include "Core/Debugger/DebugInterface.h"
 #include "Core/MIPS/MIPS.h"
 
+class JitBlockCacheDebugInterface;
+
 namespace MIPSAnalyst {
 	const int MIPS_NUM_GPRS = 32;
 
@@ -122,6 +124,25 @@ namespace MIPSAnalyst {
 	void UpdateHashMap();
 	void ApplyHashMap();
 
+	struct HotFunction {
+		u32 start;
+		u32 size;
+		u64 hash;
+		bool hasHash;
+		bool hasReplacement;
+		// Executions of the block at the function entry, so roughly the call count.
+		int64_t calls;
+		int64_t totalNanos;
+		std::string name;
+	};
+
+	// Sums up the jit's per-block profile stats into the analyzed functions containing the blocks.
+	// Requires a jit that SupportsProfiling() (IR_PROFILING.)  Sorted by time spent, hottest first.
+	std::vector<HotFunction> FindHotFunctions(const JitBlockCacheDebugInterface *blockCache, size_t maxCount);
+	// Writes the hottest functions with their hashes, so they can be identified and
+	// added to knownfuncs.ini to enable a replacement.
+	bool StoreHotFunctionReport(const Path &filename, const JitBlockCacheDebugInterface *blockCache, size_t maxCount = 100);
+
 	std::vector<MIPSGPReg> GetInputRegs(MIPSOpcode op);
 	std::vector<MIPSGPReg> GetOutputRegs(MIPSOpcode op);
 
@@ -209,6 +209,17 @@ void RiscVJitBackend::CompIR_VecLoad(IRInst inst) {
 
 	switch (inst.op) {
 	case IROp::LoadVec4:
+		if (Vec4InContext(inst.dest)) {
+			// Goes straight to the context, the next op can then use vectors too.
+			if (imm != 0) {
+				ADDI(SCRATCH1, addrReg, imm);
+				addrReg = SCRATCH1;
+			}
+			SetVec4VType();
+			VLE_V(32, V0, addrReg);
+			StoreVec4ToContext(V0, inst.dest);
+			break;
+		}
 		for (int i = 0; i < 4; ++i) {
 			// Spilling is okay.
 			regs_.MapFPR(inst.dest + i, MIPSMap::NOINIT);
@@ -380,6 +391,16 @@ void RiscVJitBackend::CompIR_VecStore(IRInst inst) {
 
 	switch (inst.op) {
 	case IROp::StoreVec4:
+		if (Vec4InContext(inst.src3)) {
+			if (imm != 0) {
+				ADDI(SCRATCH1, addrReg, imm);
+				addrReg = SCRATCH1;
+			}
+			SetVec4VType();
+			LoadVec4FromContext(V0, inst.src3);
+			VSE_V(32, V0, addrReg);
+			break;
+		}
 		for (int i = 0; i < 4; ++i) {
 			// Spilling is okay, though not ideal.
 			regs_.MapFPR(inst.src3 + i);
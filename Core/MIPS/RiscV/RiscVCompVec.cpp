@@ -16,6 +16,7 @@
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
 #include <algorithm>
+#include "Common/CPUDetect.h"
 #include "Core/MemMap.h"
 #include "Core/MIPS/RiscV/RiscVJit.h"
 #include "Core/MIPS/RiscV/RiscVRegCache.h"
@@ -39,6 +40,34 @@ static bool Overlap(IRReg r1, int l1, IRReg r2, int l2) {
 	return r1 < r2 + l2 && r1 + l1 > r2;
 }
 
+// The float regs are mapped per lane, so RVV is only used when every lane of a vector is
+// still in the context.  Then one vle32/vse32 replaces four scalar loads and stores.
+bool RiscVJitBackend::Vec4InContext(IRReg first) {
+	if (!cpu_info.RiscV_V)
+		return false;
+	for (int i = 0; i < 4; ++i) {
+		if (!regs_.IsFPRInRAM(first + i))
+			return false;
+	}
+	return true;
+}
+
+void RiscVJitBackend::SetVec4VType() {
+	// We don't track vtype across ops, it's cheap enough to set each time.
+	VSETIVLI(R_ZERO, 4, VType(32, VLMul::M1, VTail::A, VMask::A));
+}
+
+void RiscVJitBackend::LoadVec4FromContext(RiscVReg vd, IRReg first) {
+	// FPRs follow the 32 GPRs in the context.
+	ADDI(SCRATCH2, CTXREG, (32 + first) * 4);
+	VLE_V(32, vd, SCRATCH2);
+}
+
+void RiscVJitBackend::StoreVec4ToContext(RiscVReg vs3, IRReg first) {
+	ADDI(SCRATCH2, CTXREG, (32 + first) * 4);
+	VSE_V(32, vs3, SCRATCH2);
+}
+
 void RiscVJitBackend::CompIR_VecAssign(IRInst inst) {
 	CONDITIONAL_DISABLE;
 
@@ -140,7 +169,19 @@ void RiscVJitBackend::CompIR_VecAssign(IRInst inst) {
 		break;
 
 	case IROp::Vec4Shuffle:
-		if (inst.dest == inst.src1) {
+		if (Vec4InContext(inst.src1) && Vec4InContext(inst.dest)) {
+			// The lane indices fit in 16 bits each, so build them in a GPR and gather.
+			uint64_t indices = 0;
+			for (int i = 0; i < 4; ++i)
+				indices |= (uint64_t)((inst.src2 >> (i * 2)) & 3) << (i * 16);
+			LI(SCRATCH1, (int64_t)indices);
+			VSETIVLI(R_ZERO, 1, VType(64, VLMul::M1, VTail::A, VMask::A));
+			VMV_S_X(V2, SCRATCH1);
+			SetVec4VType();
+			LoadVec4FromContext(V0, inst.src1);
+			VRGATHEREI16_VV(V1, V0, V2);
+			StoreVec4ToContext(V1, inst.dest);
+		} else if (inst.dest == inst.src1) {
 			RiscVReg tempReg = regs_.MapWithFPRTemp(inst);
 
 			// Try to find the least swaps needed to move in place, never worse than 6 FMVs.
@@ -229,30 +270,71 @@ void RiscVJitBackend::CompIR_VecArith(IRInst inst) {
 
 	switch (inst.op) {
 	case IROp::Vec4Add:
+		if (Vec4InContext(inst.src1) && Vec4InContext(inst.src2) && Vec4InContext(inst.dest)) {
+			SetVec4VType();
+			LoadVec4FromContext(V0, inst.src1);
+			LoadVec4FromContext(V1, inst.src2);
+			VFADD_VV(V2, V0, V1);
+			StoreVec4ToContext(V2, inst.dest);
+			break;
+		}
 		regs_.Map(inst);
 		for (int i = 0; i < 4; ++i)
 			FADD(32, regs_.F(inst.dest + i), regs_.F(inst.src1 + i), regs_.F(inst.src2 + i));
 		break;
 
 	case IROp::Vec4Sub:
+		if (Vec4InContext(inst.src1) && Vec4InContext(inst.src2) && Vec4InContext(inst.dest)) {
+			SetVec4VType();
+			LoadVec4FromContext(V0, inst.src1);
+			LoadVec4FromContext(V1, inst.src2);
+			VFSUB_VV(V2, V0, V1);
+			StoreVec4ToContext(V2, inst.dest);
+			break;
+		}
 		regs_.Map(inst);
 		for (int i = 0; i < 4; ++i)
 			FSUB(32, regs_.F(inst.dest + i), regs_.F(inst.src1 + i), regs_.F(inst.src2 + i));
 		break;
 
 	case IROp::Vec4Mul:
+		if (Vec4InContext(inst.src1) && Vec4InContext(inst.src2) && Vec4InContext(inst.dest)) {
+			SetVec4VType();
+			LoadVec4FromContext(V0, inst.src1);
+			LoadVec4FromContext(V1, inst.src2);
+			VFMUL_VV(V2, V0, V1);
+			StoreVec4ToContext(V2, inst.dest);
+			break;
+		}
 		regs_.Map(inst);
 		for (int i = 0; i < 4; ++i)
 			FMUL(32, regs_.F(inst.dest + i), regs_.F(inst.src1 + i), regs_.F(inst.src2 + i));
 		break;
 
 	case IROp::Vec4Div:
+		if (Vec4InContext(inst.src1) && Vec4InContext(inst.src2) && Vec4InContext(inst.dest)) {
+			SetVec4VType();
+			LoadVec4FromContext(V0, inst.src1);
+			LoadVec4FromContext(V1, inst.src2);
+			VFDIV_VV(V2, V0, V1);
+			StoreVec4ToContext(V2, inst.dest);
+			break;
+		}
 		regs_.Map(inst);
 		for (int i = 0; i < 4; ++i)
 			FDIV(32, regs_.F(inst.dest + i), regs_.F(inst.src1 + i), regs_.F(inst.src2 + i));
 		break;
 
 	case IROp::Vec4Scale:
+		if (Vec4InContext(inst.src1) && Vec4InContext(inst.dest) && !Overlap(inst.src2, 1, inst.dest, 4)) {
+			// src2 may be mapped, we just need it in a float reg.
+			RiscVReg scaleReg = regs_.MapFPR(inst.src2);
+			SetVec4VType();
+			LoadVec4FromContext(V0, inst.src1);
+			VFMUL_VF(V1, V0, scaleReg);
+			StoreVec4ToContext(V1, inst.dest);
+			break;
+		}
 		regs_.Map(inst);
 		if (Overlap(inst.src2, 1, inst.dest, 3)) {
 			// We have to handle overlap, doing dest == src2 last.
@@ -293,6 +375,20 @@ void RiscVJitBackend::CompIR_VecHoriz(IRInst inst) {
 
 	switch (inst.op) {
 	case IROp::Vec4Dot:
+		if (Vec4InContext(inst.src1) && Vec4InContext(inst.src2)) {
+			SetVec4VType();
+			LoadVec4FromContext(V0, inst.src1);
+			LoadVec4FromContext(V1, inst.src2);
+			// Same FMUL then FMADD chain as the scalar path, in lane 0, so the rounding matches.
+			VFMUL_VV(V3, V0, V1);
+			for (int i = 1; i < 4; ++i) {
+				VSLIDEDOWN_VI(V4, V0, i);
+				VSLIDEDOWN_VI(V5, V1, i);
+				VFMACC_VV(V3, V4, V5);
+			}
+			VFMV_F_S(regs_.MapFPR(inst.dest, MIPSMap::NOINIT), V3);
+			break;
+		}
 		regs_.Map(inst);
 		if (Overlap(inst.dest, 1, inst.src1, 4) || Overlap(inst.dest, 1, inst.src2, 4)) {
 			// This means inst.dest overlaps one of src1 or src2.  We have to do that one first.
@@ -113,6 +113,13 @@ class RiscVJitBackend : public RiscVGen::RiscVCodeBlock, public IRNativeBackend
 	void NormalizeSrc12(IRInst inst, RiscVGen::RiscVReg *lhs, RiscVGen::RiscVReg *rhs, RiscVGen::RiscVReg lhsTempReg, RiscVGen::RiscVReg rhsTempReg, bool allowOverlap);
 	RiscVGen::RiscVReg NormalizeR(IRReg rs, IRReg rd, RiscVGen::RiscVReg tempReg);
 
+	// RVV path for Vec4 ops whose lanes all live in the context, see RiscVCompVec.cpp.
+	bool Vec4InContext(IRReg first);
+	void SetVec4VType();
+	// Note: destroys SCRATCH2.
+	void LoadVec4FromContext(RiscVGen::RiscVReg vd, IRReg first);
+	void StoreVec4ToContext(RiscVGen::RiscVReg vs3, IRReg first);
+
 	JitOptions &jo;
 	RiscVRegCache regs_;
 
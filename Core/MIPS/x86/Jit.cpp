@@ -23,10 +23,12 @@
 
 #include "Common/Math/math_util.h"
 #include "Common/Profiler/Profiler.h"
+#include "Common/Profiler/TraceRecorder.h"
 
 #include "Common/Serialize/Serializer.h"
 #include "Common/Serialize/SerializeFuncs.h"
 #include "Core/Core.h"
+#include "Core/MemFault.h"
 #include "Core/MemMap.h"
 #include "Core/System.h"
 #include "Core/CoreTiming.h"
@@ -300,6 +302,7 @@ void Jit::EatInstruction(MIPSOpcode op) {
 
 void Jit::Compile(u32 em_address) {
 	PROFILE_THIS_SCOPE("jitc");
+	TRACE_SCOPE("jit", "Compile");
 	if (GetSpaceLeft() < 0x10000 || blocks.IsFull()) {
 		ClearCache();
 	}
@@ -867,11 +870,15 @@ bool Jit::CheckJitBreakpoint(u32 addr, int downcountOffset) {
 }
 
 void Jit::CheckMemoryBreakpoint(int instructionOffset, MIPSGPReg rs, int offset) {
-	if (!g_breakpoints.HasMemChecks())
-		return;
-
 	int totalInstructionOffset = instructionOffset + (js.inDelaySlot ? 1 : 0);
 	uint32_t checkedPC = GetCompilerPC() + totalInstructionOffset * 4;
+	if (!g_breakpoints.HasJitMemChecks()) {
+		// Page protection catches these, it just needs to know which instruction it was.
+		if (Memory::MemWatch_IsActive())
+			Memory::MemWatch_MapCode(GetCodePtr(), checkedPC);
+		return;
+	}
+
 	int size = MIPSAnalyst::OpMemoryAccessSize(checkedPC);
 	bool isWrite = MIPSAnalyst::IsOpMemoryWrite(checkedPC);
 
@@ -83,16 +83,16 @@ void X64JitBackend::GenerateFixedCode(MIPSState *mipsState) {
 	}
 #endif
 
-	if (jo.useStaticAlloc && false) {
+	if (jo.useStaticAlloc) {
 		saveStaticRegisters_ = AlignCode16();
 		if (jo.downcountInRegister)
 			MOV(32, MDisp(CTXREG, downcountOffset), R(DOWNCOUNTREG));
-		//regs_.EmitSaveStaticRegisters();
+		regs_.EmitSaveStaticRegisters();
 		RET();
 
 		// Note: needs to not modify EAX, or to save it if it does.
 		loadStaticRegisters_ = AlignCode16();
-		//regs_.EmitLoadStaticRegisters();
+		regs_.EmitLoadStaticRegisters();
 		if (jo.downcountInRegister)
 			MOV(32, R(DOWNCOUNTREG), MDisp(CTXREG, downcountOffset));
 		RET();
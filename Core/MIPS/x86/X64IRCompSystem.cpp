@@ -19,6 +19,7 @@
 #if PPSSPP_ARCH(X86) || PPSSPP_ARCH(AMD64)
 
 #include "Common/Profiler/Profiler.h"
+#include "Core/Config.h"
 #include "Core/Core.h"
 #include "Core/Debugger/Breakpoints.h"
 #include "Core/HLE/HLE.h"
@@ -107,6 +108,7 @@ void X64JitBackend::CompIR_Breakpoint(IRInst inst) {
 	switch (inst.op) {
 	case IROp::Breakpoint:
 		FlushAll();
+		SaveStaticRegisters();
 		// Note: the constant could be a delay slot.
 		ABI_CallFunctionC((const void *)&IRRunBreakpoint, inst.constant);
 		TEST(32, R(EAX), R(EAX));
@@ -133,6 +135,7 @@ void X64JitBackend::CompIR_Breakpoint(IRInst inst) {
 
 				// We need to flush, or conditions and log expressions will see old register values.
 				FlushAll();
+				SaveStaticRegisters();
 
 				ABI_CallFunctionCC((const void *)&IRRunMemCheck, checkedPC, iaddr);
 				TEST(32, R(EAX), R(EAX));
@@ -157,6 +160,7 @@ void X64JitBackend::CompIR_Breakpoint(IRInst inst) {
 
 			// We need to flush, or conditions and log expressions will see old register values.
 			FlushAll();
+			SaveStaticRegisters();
 
 			std::vector<FixupBranch> hitChecks;
 			for (const auto &it : memchecks) {
@@ -195,6 +199,47 @@ void X64JitBackend::CompIR_Breakpoint(IRInst inst) {
 	}
 }
 
+void X64JitBackend::WriteDirectSyscall(const HLEFunction *info) {
+	const HLEDirectSyscallState &state = GetDirectSyscallState();
+
+	// This is CallSyscallWithoutFlags(), but calling info->func directly.
+	MOV(PTRBITS, R(SCRATCH1), ImmPtr(state.stack));
+	MOV(PTRBITS, R(EDX), ImmPtr(info));
+	MOV(PTRBITS, MatR(SCRATCH1), R(EDX));
+	MOV(PTRBITS, R(SCRATCH1), ImmPtr(state.stackSize));
+	MOV(32, MatR(SCRATCH1), Imm32(1));
+	MOV(32, R(EDX), MDisp(CTXREG, pcOffset));
+	MOV(PTRBITS, R(SCRATCH1), ImmPtr(state.syscallPC));
+	MOV(32, MatR(SCRATCH1), R(EDX));
+
+	ABI_CallFunction((const void *)info->func);
+
+	// Most syscalls don't request anything afterward, so just clear ll and fill deadbeef inline.
+	MOV(PTRBITS, R(SCRATCH1), ImmPtr(state.afterSyscall));
+	CMP(32, MatR(SCRATCH1), Imm8(0));
+	FixupBranch needsFinish = J_CC(CC_NZ, true);
+
+	MOV(32, MDisp(CTXREG, IRREG_LLBIT * 4 - 128), Imm32(0));
+	if (!g_Config.bSkipDeadbeefFilling) {
+		static const IRReg deadbeefRegs[] = {
+			MIPS_REG_COMPILER_SCRATCH,
+			MIPS_REG_A0, MIPS_REG_A1, MIPS_REG_A2, MIPS_REG_A3,
+			MIPS_REG_T0, MIPS_REG_T1, MIPS_REG_T2, MIPS_REG_T3,
+			MIPS_REG_T4, MIPS_REG_T5, MIPS_REG_T6, MIPS_REG_T7,
+			MIPS_REG_T8, MIPS_REG_T9, IRREG_LO, IRREG_HI,
+		};
+		for (IRReg r : deadbeefRegs)
+			MOV(32, MDisp(CTXREG, r * 4 - 128), Imm32(0xDEADBEEF));
+	}
+	MOV(PTRBITS, R(SCRATCH1), ImmPtr(state.stackSize));
+	MOV(32, MatR(SCRATCH1), Imm32(0));
+	FixupBranch skipFinish = J(true);
+
+	SetJumpTarget(needsFinish);
+	ABI_CallFunctionP((const void *)&hleFinishDirectSyscall, (void *)info);
+	SetJumpTarget(skipFinish);
+}
+
 void X64JitBackend::CompIR_System(IRInst inst) {
 	CONDITIONAL_DISABLE;
 
@@ -211,8 +256,11 @@ void X64JitBackend::CompIR_System(IRInst inst) {
 		// Skip the CallSyscall where possible.
 		{
 			MIPSOpcode op(inst.constant);
-			void *quickFunc = GetQuickSyscallFunc(op);
-			if (quickFunc) {
+			const HLEFunction *directFunc = GetDirectSyscallFunc(op);
+			void *quickFunc = directFunc ? nullptr : GetQuickSyscallFunc(op);
+			if (directFunc) {
+				WriteDirectSyscall(directFunc);
+			} else if (quickFunc) {
 				ABI_CallFunctionP((const u8 *)quickFunc, (void *)GetSyscallFuncPointer(op));
 			} else {
 				ABI_CallFunctionC((const u8 *)&CallSyscall, inst.constant);
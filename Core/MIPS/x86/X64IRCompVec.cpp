@@ -21,6 +21,7 @@
 #include <algorithm>
 #include "Common/CPUDetect.h"
 #include "Core/MemMap.h"
+#include "Core/MIPS/IR/IRAnalysis.h"
 #include "Core/MIPS/x86/X64IRJit.h"
 #include "Core/MIPS/x86/X64IRRegCache.h"
 
@@ -64,6 +65,51 @@ void X64JitBackend::EmitVecConstants() {
 	}
 }
 
+// The IR expands vmmul into Vec4Scale temp, s, t followed by Vec4Add acc, acc, temp.
+// With FMA3, do both at once.  Note that this rounds once instead of twice, which is
+// closer to the VFPU's own dot product, but differs from the interpreter and hosts
+// without FMA3.  So it's off unless JitFuseFMA is set.
+bool X64JitBackend::TryFuseVec4ScaleAdd(IRInst inst) {
+	if (!jo.fuseVec4FMA || !cpu_info.bFMA3 || compilingIndex_ + 1 >= compilingNumInsts_)
+		return false;
+	const IRInst &next = compilingInsts_[compilingIndex_ + 1];
+	if (next.op != IROp::Vec4Add || next.dest == inst.dest)
+		return false;
+	IRReg acc = next.dest;
+	if (!(next.src1 == acc && next.src2 == inst.dest) && !(next.src2 == acc && next.src1 == inst.dest))
+		return false;
+	// Lane aliasing isn't supported by the reg cache, so the vectors must match or be separate.
+	if (Overlap(acc, 4, inst.dest, 4) || Overlap(acc, 4, inst.src2, 1))
+		return false;
+	if (acc != inst.src1 && Overlap(acc, 4, inst.src1, 4))
+		return false;
+
+	// We skip writing the scaled vector, so it must be dead.  Only trust that for temps.
+	if (inst.dest < IRVTEMP_PFX_S)
+		return false;
+	IRSituation info;
+	info.lookaheadCount = 30;
+	info.currentIndex = compilingIndex_ + 2;
+	info.instructions = compilingInsts_;
+	info.numInstructions = compilingNumInsts_;
+	// UNUSED means the lookahead ran out before the end of the block, so it might still be read.
+	// WRITE means the very next op overwrites it, like the next vmmul Vec4Scale into the same temp.
+	for (int i = 0; i < 4; ++i) {
+		IRUsage usage = IRNextFPRUsage(inst.dest + i, info);
+		if (usage != IRUsage::CLOBBERED && usage != IRUsage::WRITE)
+			return false;
+	}
+
+	IRInst fused = inst;
+	fused.dest = acc;
+	// Vec4Scale doesn't read its dest, so map the accumulator as an input too.
+	regs_.MapWithExtra(fused, { { 'V', acc, 4, MIPSMap::INIT } });
+	SHUFPS(regs_.FX(inst.src2), regs_.F(inst.src2), 0);
+	VFMADD231PS(128, regs_.FX(acc), regs_.FX(inst.src1), regs_.F(inst.src2));
+	skipNextInst_ = true;
+	return true;
+}
+
 void X64JitBackend::CompIR_VecArith(IRInst inst) {
 	CONDITIONAL_DISABLE;
 
@@ -138,6 +184,8 @@ void X64JitBackend::CompIR_VecArith(IRInst inst) {
 		// TODO: Handle "aliasing" of sizes.
 		if (Overlap(inst.dest, 4, inst.src2, 1) || Overlap(inst.src1, 4, inst.src2, 1))
 			DISABLE;
+		if (TryFuseVec4ScaleAdd(inst))
+			break;
 
 		regs_.Map(inst);
 		SHUFPS(regs_.FX(inst.src2), regs_.F(inst.src2), 0);
@@ -281,11 +329,19 @@ void X64JitBackend::CompIR_VecHoriz(IRInst inst) {
 		}
 
 		// This shuffle can be done in one op for SSE3/AVX, but it's not always faster.
-		MOVAPS(tempReg, regs_.F(inst.dest));
-		SHUFPS(tempReg, regs_.F(inst.dest), VFPU_SWIZZLE(1, 0, 3, 2));
-		ADDPS(regs_.FX(inst.dest), R(tempReg));
-		MOVHLPS(tempReg, regs_.FX(inst.dest));
-		ADDSS(regs_.FX(inst.dest), R(tempReg));
+		if (cpu_info.bAVX) {
+			// Same sums in the same order, just without the copies.
+			VPERMILPS(128, tempReg, regs_.F(inst.dest), VFPU_SWIZZLE(1, 0, 3, 2));
+			VADDPS(128, regs_.FX(inst.dest), regs_.FX(inst.dest), R(tempReg));
+			VMOVHLPS(tempReg, tempReg, regs_.FX(inst.dest));
+			VADDSS(regs_.FX(inst.dest), regs_.FX(inst.dest), R(tempReg));
+		} else {
+			MOVAPS(tempReg, regs_.F(inst.dest));
+			SHUFPS(tempReg, regs_.F(inst.dest), VFPU_SWIZZLE(1, 0, 3, 2));
+			ADDPS(regs_.FX(inst.dest), R(tempReg));
+			MOVHLPS(tempReg, regs_.FX(inst.dest));
+			ADDSS(regs_.FX(inst.dest), R(tempReg));
+		}
 		break;
 	}
 
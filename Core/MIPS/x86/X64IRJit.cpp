@@ -91,12 +91,21 @@ bool X64JitBackend::CompileBlock(IRBlockCache *irBlockCache, int block_num, bool
 	std::vector<const u8 *> addresses;
 	addresses.reserve(block->GetNumIRInstructions());
 	const IRInst *instructions = irBlockCache->GetBlockInstructionPtr(*block);
+	compilingInsts_ = instructions;
+	compilingNumInsts_ = block->GetNumIRInstructions();
 	for (int i = 0; i < block->GetNumIRInstructions(); ++i) {
 		const IRInst &inst = instructions[i];
 		regs_.SetIRIndex(i);
+		compilingIndex_ = i;
 		addresses.push_back(GetCodePtr());
 
 		CompileIRInst(inst);
+		if (skipNextInst_) {
+			// The op was fused with the next one, which shares its code.
+			skipNextInst_ = false;
+			addresses.push_back(addresses.back());
+			++i;
+		}
 
 		if (jo.Disabled(JitDisable::REGALLOC_GPR) || jo.Disabled(JitDisable::REGALLOC_FPR))
 			regs_.FlushAll(jo.Disabled(JitDisable::REGALLOC_GPR), jo.Disabled(JitDisable::REGALLOC_FPR));
@@ -380,7 +389,7 @@ void X64JitBackend::WriteDebugProfilerStatus(IRProfilerStatus status) {
 
 void X64JitBackend::SaveStaticRegisters() {
 	if (jo.useStaticAlloc) {
-		//CALL(saveStaticRegisters_);
+		CALL(saveStaticRegisters_);
 	} else if (jo.downcountInRegister) {
 		// Inline the single operation
 		MOV(32, MDisp(CTXREG, downcountOffset), R(DOWNCOUNTREG));
@@ -389,7 +398,7 @@ void X64JitBackend::SaveStaticRegisters() {
 
 void X64JitBackend::LoadStaticRegisters() {
 	if (jo.useStaticAlloc) {
-		//CALL(loadStaticRegisters_);
+		CALL(loadStaticRegisters_);
 	} else if (jo.downcountInRegister) {
 		MOV(32, R(DOWNCOUNTREG), MDisp(CTXREG, downcountOffset));
 	}
@@ -42,6 +42,8 @@
 #define X64JIT_USE_XMM_CALL 0
 #endif
 
+struct HLEFunction;
+
 namespace MIPSComp {
 
 class X64JitBackend : public Gen::XCodeBlock, public IRNativeBackend {
@@ -69,6 +71,7 @@ class X64JitBackend : public Gen::XCodeBlock, public IRNativeBackend {
 	void WriteDebugPC(uint32_t pc);
 	void WriteDebugPC(Gen::X64Reg r);
 	void WriteDebugProfilerStatus(IRProfilerStatus status);
+	void WriteDirectSyscall(const HLEFunction *info);
 
 	void SaveStaticRegisters();
 	void LoadStaticRegisters();
@@ -128,6 +131,7 @@ class X64JitBackend : public Gen::XCodeBlock, public IRNativeBackend {
 
 	Gen::OpArg PrepareSrc1Address(IRInst inst);
 	void CopyVec4ToFPRLane0(Gen::X64Reg dest, Gen::X64Reg src, int lane);
+	bool TryFuseVec4ScaleAdd(IRInst inst);
 
 	JitOptions &jo;
 	X64IRRegCache regs_;
@@ -161,6 +165,11 @@ class X64JitBackend : public Gen::XCodeBlock, public IRNativeBackend {
 
 	int jitStartOffset_ = 0;
 	int compilingBlockNum_ = -1;
+	// The block being compiled, so ops can peek ahead and consume the next one.
+	const IRInst *compilingInsts_ = nullptr;
+	int compilingNumInsts_ = 0;
+	int compilingIndex_ = 0;
+	bool skipNextInst_ = false;
 	int logBlocks_ = 0;
 	// Only useful in breakpoints, where it's set immediately prior.
 	uint32_t lastConstPC_ = 0;
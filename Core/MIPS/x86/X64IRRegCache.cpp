@@ -49,6 +49,8 @@ const int *X64IRRegCache::GetAllocationOrder(MIPSLoc type, MIPSMap flags, int &c
 	if (type == MIPSLoc::REG) {
 		base = RAX;
 
+		// R12 and R13 are callee saved, so they're used for static allocations.
+		// When useStaticAlloc is on, they're omitted here and added in GetStaticAllocations.
 		static const int allocationOrder[] = {
 #if PPSSPP_ARCH(AMD64)
 #ifdef _WIN32
@@ -62,6 +64,17 @@ const int *X64IRRegCache::GetAllocationOrder(MIPSLoc type, MIPSMap flags, int &c
 			ESI, EDI, EDX, EBX, ECX,
 #endif
 		};
+#if PPSSPP_ARCH(AMD64)
+		static const int allocationOrderStaticAlloc[] = {
+#ifdef _WIN32
+			RSI, RDI, R8, R9, R10, R11, RDX, RCX,
+#else
+			RBP, R8, R9, R10, R11, RDX, RCX,
+#endif
+			// Intentionally last.
+			R15,
+		};
+#endif
 
 		if ((flags & X64Map::MASK) == X64Map::SHIFT) {
 			// It's a single option for shifts.
@@ -84,6 +97,10 @@ const int *X64IRRegCache::GetAllocationOrder(MIPSLoc type, MIPSMap flags, int &c
 			return lowSubRegAllocationOrder;
 		}
 #else
+		if (jo_->useStaticAlloc) {
+			count = ARRAY_SIZE(allocationOrderStaticAlloc) - (jo_->reserveR15ForAsm ? 1 : 0);
+			return allocationOrderStaticAlloc;
+		}
 		if (jo_->reserveR15ForAsm) {
 			count = ARRAY_SIZE(allocationOrder) - 1;
 			return allocationOrder;
@@ -119,6 +136,39 @@ const int *X64IRRegCache::GetAllocationOrder(MIPSLoc type, MIPSMap flags, int &c
 	}
 }
 
+const X64IRRegCache::StaticAllocation *X64IRRegCache::GetStaticAllocations(int &count) const {
+#if PPSSPP_ARCH(AMD64)
+	// These are the registers most often live across block exits (function prologues, epilogues, returns.)
+	static const StaticAllocation allocs[] = {
+		{ MIPS_REG_SP, (IRNativeReg)R12, MIPSLoc::REG },
+		{ MIPS_REG_RA, (IRNativeReg)R13, MIPSLoc::REG },
+	};
+
+	if (jo_->useStaticAlloc) {
+		count = ARRAY_SIZE(allocs);
+		return allocs;
+	}
+#endif
+	return IRNativeRegCacheBase::GetStaticAllocations(count);
+}
+
+void X64IRRegCache::EmitLoadStaticRegisters() {
+	int count = 0;
+	const StaticAllocation *allocs = GetStaticAllocations(count);
+	// Note: must not modify EAX, the dispatcher relies on it.
+	for (int i = 0; i < count; ++i) {
+		_assert_(!allocs[i].pointerified);
+		emit_->MOV(32, ::R(FromNativeReg(allocs[i].nr)), MDisp(CTXREG, -128 + GetMipsRegOffset(allocs[i].mr)));
+	}
+}
+
+void X64IRRegCache::EmitSaveStaticRegisters() {
+	int count = 0;
+	const StaticAllocation *allocs = GetStaticAllocations(count);
+	for (int i = 0; i < count; ++i)
+		emit_->MOV(32, MDisp(CTXREG, -128 + GetMipsRegOffset(allocs[i].mr)), ::R(FromNativeReg(allocs[i].nr)));
+}
+
 void X64IRRegCache::FlushBeforeCall() {
 	// These registers are not preserved by function calls.
 #if PPSSPP_ARCH(AMD64)
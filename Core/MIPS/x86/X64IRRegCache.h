@@ -96,6 +96,9 @@ class X64IRRegCache : public IRNativeRegCacheBase {
 	void FlushAll(bool gprs = true, bool fprs = true) override;
 	void FlushBeforeCall();
 
+	void EmitLoadStaticRegisters();
+	void EmitSaveStaticRegisters();
+
 	Gen::X64Reg GetAndLockTempGPR();
 	Gen::X64Reg GetAndLockTempFPR();
 	void ReserveAndLockXGPR(Gen::X64Reg r);
@@ -111,6 +114,7 @@ class X64IRRegCache : public IRNativeRegCacheBase {
 
 protected:
 	const int *GetAllocationOrder(MIPSLoc type, MIPSMap flags, int &count, int &base) const override;
+	const StaticAllocation *GetStaticAllocations(int &count) const override;
 	void AdjustNativeRegAsPtr(IRNativeReg nreg, bool state) override;
 
 	void LoadNativeReg(IRNativeReg nreg, IRReg first, int lanes) override;
@@ -17,13 +17,24 @@
 
 #include "ppsspp_config.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <unordered_set>
 #include <mutex>
 #include <sstream>
+#include <thread>
 
 #include "Common/StringUtils.h"
+#include "Common/ExceptionHandlerSetup.h"
 #include "Common/MachineContext.h"
+#include "Common/MemoryUtil.h"
+#include "Common/TimeUtil.h"
+
+#if !PPSSPP_PLATFORM(WINDOWS)
+#include <pthread.h>
+#include <signal.h>
+#endif
 
 #if PPSSPP_ARCH(AMD64) || PPSSPP_ARCH(X86)
 #include "Common/x64Analyzer.h"
@@ -40,6 +51,7 @@
 #include "Core/MemFault.h"
 #include "Core/MemMap.h"
 #include "Core/MIPS/JitCommon/JitCommon.h"
+#include "Core/Debugger/Breakpoints.h"
 #include "Core/Debugger/SymbolMap.h"
 
 // Stack walking stuff
@@ -56,11 +68,149 @@ static bool inCrashHandler = false;
 
 std::unordered_set<const uint8_t *> g_ignoredAddresses;
 
+// Memory checks through page protection need to single step the faulting access with the trap flag,
+// so this is x86-64 only for now.
+#if defined(MACHINE_CONTEXT_SUPPORTED) && defined(CTX_FLAGS) && !defined(MASKED_PSP_MEMORY)
+#define MEMWATCH_SUPPORTED
+#endif
+
+#ifdef MEMWATCH_SUPPORTED
+
+// Past this, it's likely faster to just check in the jit.
+static const size_t MEMWATCH_MAX_PAGES = 64;
+// Counting every mirror: RAM has 4, VRAM has 2 segments of 4.
+static const size_t MEMWATCH_MAX_MIRROR_PAGES = MEMWATCH_MAX_PAGES * 8;
+static const uintptr_t TRAP_FLAG = 0x100;
+
+struct MemWatchPage {
+	u32 addr;
+	u32 prot;
+
+	bool operator <(const MemWatchPage &other) const {
+		return addr < other.addr;
+	}
+};
+
+// All of this is also used by the fault and single step handlers, which can't allocate or take
+// a mutex. So it lives in fixed arrays, and the page state is guarded by g_memWatchSpin.
+// Outside the handlers, that's only taken with the fault signals blocked (see MemWatchSpinGuard),
+// so a handler never spins on a lock held by its own thread. Nothing faults while holding it.
+
+// Watched pages in every mirror, sorted.
+static MemWatchPage g_memWatchPages[MEMWATCH_MAX_MIRROR_PAGES];
+static size_t g_memWatchPageCount = 0;
+// Pages temporarily opened up to let an access through, protected again when all steps are done.
+static u32 g_memWatchLifted[MEMWATCH_MAX_MIRROR_PAGES];
+static size_t g_memWatchLiftedCount = 0;
+static int g_memWatchStepping = 0;
+static u32 g_memWatchPageSize = 0;
+static std::atomic_flag g_memWatchSpin = ATOMIC_FLAG_INIT;
+// Only keeps MemWatch_SetRanges() calls apart, never taken by the handlers.
+static std::mutex g_memWatchSetLock;
+
+class MemWatchSpinGuard {
+public:
+	// The handlers pass true, the signals are already blocked there.
+	explicit MemWatchSpinGuard(bool inHandler) : blockSignals_(!inHandler) {
+#if !PPSSPP_PLATFORM(WINDOWS)
+		if (blockSignals_) {
+			sigset_t set;
+			sigemptyset(&set);
+			sigaddset(&set, SIGSEGV);
+			sigaddset(&set, SIGBUS);
+			sigaddset(&set, SIGTRAP);
+			pthread_sigmask(SIG_BLOCK, &set, &oldMask_);
+		}
+#endif
+		while (g_memWatchSpin.test_and_set(std::memory_order_acquire))
+			continue;
+	}
+	~MemWatchSpinGuard() {
+		g_memWatchSpin.clear(std::memory_order_release);
+#if !PPSSPP_PLATFORM(WINDOWS)
+		if (blockSignals_)
+			pthread_sigmask(SIG_SETMASK, &oldMask_, nullptr);
+#endif
+	}
+
+private:
+	bool blockSignals_;
+#if !PPSSPP_PLATFORM(WINDOWS)
+	sigset_t oldMask_;
+#endif
+};
+
+// A jit access to a page watched for reads could be either a read or a write. We first only allow
+// reads, and if the step completes without faulting again, report it as a read.
+struct MemWatchPendingRead {
+	bool valid;
+	std::thread::id thread;
+	u32 addr;
+	int size;
+	u32 pc;
+};
+static MemWatchPendingRead g_memWatchPendingRead;
+
+#endif
+
+static std::atomic<bool> g_memWatchActive;
+
+// Memchecks can log, read memory, or break, none of which is safe inside the handlers.
+// So hits go into this ring, and MemWatch_ReportHits() runs them later. Only jitted code reports
+// hits, so the emu thread is the only producer (in the handlers) and also the consumer.
+struct MemWatchHit {
+	u32 addr;
+	int size;
+	u32 pc;
+	bool write;
+	// For writes, whether the value changed.
+	bool changed;
+	u8 oldValue[16];
+};
+static const u32 MEMWATCH_MAX_HITS = 256;
+static MemWatchHit g_memWatchHits[MEMWATCH_MAX_HITS];
+static std::atomic<u32> g_memWatchHitsHead;
+static std::atomic<u32> g_memWatchHitsTail;
+static std::atomic<int> g_memWatchHitsDropped;
+std::atomic<bool> g_memWatchHasHits;
+// The write being stepped, queued once we know whether it changed the value.
+static MemWatchHit g_memWatchSteppingWrite;
+static bool g_memWatchSteppingWriteValid = false;
+// False if oldValue couldn't be read, then we assume it changed.
+static bool g_memWatchSteppingWriteCompare = false;
+static std::thread::id g_memWatchSteppingWriteThread;
+
+// Host code address -> guest PC, sorted (code is emitted in order.) Only used on the emu thread,
+// by the jit and by the fault handler when jitted code faults, so never both at once.
+struct MemWatchCodeMapping {
+	const u8 *hostPtr;
+	u32 guestPC;
+};
+static std::vector<MemWatchCodeMapping> g_memWatchCodeMap;
+
 void MemFault_Init() {
 	g_numReportedBadAccesses = 0;
 	g_lastCrashAddress = nullptr;
 	g_lastMemoryExceptionType = MemoryExceptionType::NONE;
 	g_ignoredAddresses.clear();
+
+	// Memory was just mapped, so nothing is protected anymore.
+#ifdef MEMWATCH_SUPPORTED
+	{
+		MemWatchSpinGuard guard(false);
+		g_memWatchPageCount = 0;
+		g_memWatchLiftedCount = 0;
+		g_memWatchStepping = 0;
+		g_memWatchPendingRead.valid = false;
+		g_memWatchSteppingWriteValid = false;
+	}
+	if (g_memWatchActive)
+		EnableSingleStepHandler(false);
+#endif
+	g_memWatchHitsTail = g_memWatchHitsHead.load();
+	g_memWatchHitsDropped = 0;
+	g_memWatchHasHits = false;
+	g_memWatchActive = false;
 }
 
 bool MemFault_MayBeResumable() {
@@ -71,6 +221,135 @@ void MemFault_IgnoreLastCrash() {
 	g_ignoredAddresses.insert(g_lastCrashAddress);
 }
 
+#ifdef MEMWATCH_SUPPORTED
+
+// Calls func for each address that maps to the same memory (see views in MemMap.cpp.)
+template <typename F>
+static void ForEachMirror(u32 addr, F func) {
+	const u32 offset = addr & 0x3FFFFFFF;
+	const u32 segments = IsVRAMAddress(offset) || IsScratchpadAddress(offset) ? 2 : 4;
+	for (u32 seg = 0; seg < segments; ++seg) {
+		u32 mirror = offset | (seg << 30);
+		if (IsVRAMAddress(mirror)) {
+			for (u32 vram = 0; vram < 4; ++vram)
+				func((mirror & ~0x00600000) + 0x00200000 * vram);
+		} else if (IsValidAddress(mirror)) {
+			func(mirror);
+		}
+	}
+}
+
+// Needs g_memWatchSpin held.
+static const MemWatchPage *MemWatch_FindPage(u32 addr) {
+	const MemWatchPage *end = g_memWatchPages + g_memWatchPageCount;
+	MemWatchPage key{ addr & ~(g_memWatchPageSize - 1), 0 };
+	const MemWatchPage *it = std::lower_bound((const MemWatchPage *)g_memWatchPages, end, key);
+	if (it != end && it->addr == key.addr)
+		return it;
+	return nullptr;
+}
+
+#endif
+
+bool MemWatch_SetRanges(const std::vector<MemWatchRange> &ranges) {
+#ifdef MEMWATCH_SUPPORTED
+	std::lock_guard<std::mutex> setGuard(g_memWatchSetLock);
+	if (!base)
+		return false;
+	u32 pageSize = (u32)GetMemoryProtectPageSize();
+
+	std::vector<MemWatchPage> pages;
+	size_t uniquePages = 0;
+	for (const MemWatchRange &range : ranges) {
+		u64 end = std::max((u64)range.end, (u64)range.start + 1);
+		for (u64 addr = range.start & ~(pageSize - 1); addr < end; addr += pageSize) {
+			if (++uniquePages > MEMWATCH_MAX_PAGES)
+				break;
+			ForEachMirror((u32)addr, [&](u32 mirror) {
+				pages.push_back(MemWatchPage{ mirror, range.read ? 0 : (u32)MEM_PROT_READ });
+			});
+		}
+	}
+
+	// Merge duplicates, watching reads wins.
+	std::sort(pages.begin(), pages.end(), [](const MemWatchPage &a, const MemWatchPage &b) {
+		return a.addr < b.addr || (a.addr == b.addr && a.prot < b.prot);
+	});
+	pages.erase(std::unique(pages.begin(), pages.end(), [](const MemWatchPage &a, const MemWatchPage &b) {
+		return a.addr == b.addr;
+	}), pages.end());
+	if (uniquePages > MEMWATCH_MAX_PAGES || pages.size() > MEMWATCH_MAX_MIRROR_PAGES)
+		pages.clear();
+
+	bool wasActive = g_memWatchActive;
+	// The trap handler has to be there before anything can fault.
+	if (!pages.empty() && !wasActive && !EnableSingleStepHandler(true))
+		pages.clear();
+
+	{
+		MemWatchSpinGuard guard(false);
+		g_memWatchPageSize = pageSize;
+		for (size_t i = 0; i < g_memWatchPageCount; ++i) {
+			const MemWatchPage &page = g_memWatchPages[i];
+			if (!std::binary_search(pages.begin(), pages.end(), page))
+				ProtectMemoryPages(base + page.addr, g_memWatchPageSize, MEM_PROT_READ | MEM_PROT_WRITE);
+		}
+		for (const MemWatchPage &page : pages)
+			ProtectMemoryPages(base + page.addr, g_memWatchPageSize, page.prot);
+
+		std::copy(pages.begin(), pages.end(), g_memWatchPages);
+		g_memWatchPageCount = pages.size();
+	}
+	g_memWatchActive = !pages.empty();
+
+	if (wasActive && pages.empty()) {
+		// Let any access still being stepped on another thread finish, before its trap has nowhere to go.
+		while (true) {
+			{
+				MemWatchSpinGuard guard(false);
+				if (g_memWatchStepping == 0)
+					break;
+			}
+			sleep_ms(1, "memwatch-step");
+		}
+		EnableSingleStepHandler(false);
+	}
+	// Note that the code map stays, only jit clears make it stale (see MemWatch_MapCode.)
+	return uniquePages <= MEMWATCH_MAX_PAGES && (ranges.empty() || !pages.empty());
+#else
+	return false;
+#endif
+}
+
+bool MemWatch_IsActive() {
+	return g_memWatchActive;
+}
+
+void MemWatch_MapCode(const u8 *hostPtr, u32 guestPC) {
+	// Code space is only ever reused after the jit is cleared, so anything at or after this is stale.
+	// That way we drop the mappings exactly when the jit drops the code.
+	while (!g_memWatchCodeMap.empty() && g_memWatchCodeMap.back().hostPtr >= hostPtr)
+		g_memWatchCodeMap.pop_back();
+	g_memWatchCodeMap.push_back(MemWatchCodeMapping{ hostPtr, guestPC });
+}
+
+void MemWatch_ReportHits() {
+	g_memWatchHasHits = false;
+	int dropped = g_memWatchHitsDropped.exchange(0);
+	if (dropped != 0)
+		WARN_LOG(Log::JIT, "Too many memory check hits at once, dropped %d", dropped);
+
+	// We're the only consumer, and the handlers only add to the ring, so no locking.
+	// These may touch watched memory and fault again, but only jitted accesses add hits.
+	u32 tail = g_memWatchHitsTail.load(std::memory_order_relaxed);
+	const u32 head = g_memWatchHitsHead.load(std::memory_order_acquire);
+	while (tail != head) {
+		const MemWatchHit hit = g_memWatchHits[tail % MEMWATCH_MAX_HITS];
+		g_memWatchHitsTail.store(++tail, std::memory_order_release);
+		g_breakpoints.ExecMemCheck(hit.addr, hit.write, hit.size, hit.pc, "CPU", !hit.write || hit.changed);
+	}
+}
+
 #ifdef MACHINE_CONTEXT_SUPPORTED
 
 static bool DisassembleNativeAt(const uint8_t *codePtr, int instructionSize, std::string *dest) {
@@ -102,7 +381,140 @@ static bool DisassembleNativeAt(const uint8_t *codePtr, int instructionSize, std
 	return false;
 }
 
+#ifdef MEMWATCH_SUPPORTED
+
+// Called in the fault handler on the emu thread, so no allocating or locking.
+static u32 MemWatch_GuestPC(const u8 *codePtr) {
+	auto it = std::upper_bound(g_memWatchCodeMap.begin(), g_memWatchCodeMap.end(), codePtr, [](const u8 *ptr, const MemWatchCodeMapping &mapping) {
+		return ptr < mapping.hostPtr;
+	});
+	if (it != g_memWatchCodeMap.begin())
+		return (it - 1)->guestPC;
+	// Compiled before watching started? Shouldn't happen, the jit is cleared.
+	return currentMIPS->pc;
+}
+
+// Only called from the handlers on the emu thread, see g_memWatchHits.
+static void MemWatch_QueueHit(const MemWatchHit &hit) {
+	u32 head = g_memWatchHitsHead.load(std::memory_order_relaxed);
+	if (head - g_memWatchHitsTail.load(std::memory_order_acquire) >= MEMWATCH_MAX_HITS) {
+		g_memWatchHitsDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	g_memWatchHits[head % MEMWATCH_MAX_HITS] = hit;
+	g_memWatchHitsHead.store(head + 1, std::memory_order_release);
+	g_memWatchHasHits.store(true, std::memory_order_relaxed);
+}
+
+static bool MemWatch_HandleFault(uintptr_t hostAddress, SContext *context) {
+	uintptr_t baseAddress = (uintptr_t)base;
+	if (hostAddress < baseAddress || hostAddress >= baseAddress + 0x100000000ULL)
+		return false;
+	u32 guestAddress = (u32)(hostAddress - baseAddress);
+
+	MemWatchSpinGuard guard(true);
+	const MemWatchPage *page = MemWatch_FindPage(guestAddress);
+	if (!page)
+		return false;
+
+	// Only jitted accesses are reported here. The interpreter and HLE check memchecks themselves,
+	// and other threads (like the GPU) are not CPU accesses, so we just let them through.
+	const uint8_t *codePtr = (const uint8_t *)context->CTX_RIP;
+	bool report = false;
+	int size = 4;
+	u32 pc = 0;
+	u32 liftTo = MEM_PROT_READ | MEM_PROT_WRITE;
+	// Instruction fetches by the dispatcher aren't reported, same as in the interpreter.
+	if (MIPSComp::jit && MIPSComp::jit->CodeInRange(codePtr) && !MIPSComp::jit->IsAtDispatchFetch(codePtr)) {
+		LSInstructionInfo info{};
+		if (X86AnalyzeMOV(codePtr, info))
+			size = info.operandSize;
+		pc = MemWatch_GuestPC(codePtr);
+
+		MemWatchPendingRead &pending = g_memWatchPendingRead;
+		if (page->prot == MEM_PROT_READ || (pending.valid && pending.thread == std::this_thread::get_id())) {
+			// Faulted while reads were allowed, so this is a write.
+			pending.valid = false;
+			report = true;
+		} else {
+			pending = MemWatchPendingRead{ true, std::this_thread::get_id(), guestAddress, size, pc };
+			liftTo = MEM_PROT_READ;
+		}
+	}
+
+	u32 pageAddr = guestAddress & ~(g_memWatchPageSize - 1);
+	ProtectMemoryPages(base + pageAddr, g_memWatchPageSize, liftTo);
+	const u32 *liftedEnd = g_memWatchLifted + g_memWatchLiftedCount;
+	// Can't overflow, only watched pages are lifted.
+	if (std::find((const u32 *)g_memWatchLifted, liftedEnd, pageAddr) == liftedEnd)
+		g_memWatchLifted[g_memWatchLiftedCount++] = pageAddr;
+	// If we're already stepping this instruction, it touched another watched page (or we now know it's a write.)
+	if ((context->CTX_FLAGS & TRAP_FLAG) == 0) {
+		context->CTX_FLAGS |= TRAP_FLAG;
+		g_memWatchStepping++;
+	}
+
+	if (report) {
+		MemWatchHit &hit = g_memWatchSteppingWrite;
+		hit = MemWatchHit{ guestAddress, std::min(size, (int)sizeof(MemWatchHit::oldValue)), pc, true, true };
+		g_memWatchSteppingWriteValid = true;
+		g_memWatchSteppingWriteThread = std::this_thread::get_id();
+		// Now that it's readable, keep the old value to tell if the write changes it.
+		// If it spills into the next page, that one might not be readable, so just assume it changed.
+		g_memWatchSteppingWriteCompare = (guestAddress & (g_memWatchPageSize - 1)) + hit.size <= g_memWatchPageSize;
+		if (g_memWatchSteppingWriteCompare)
+			memcpy(hit.oldValue, base + guestAddress, hit.size);
+	}
+	return true;
+}
+
+bool HandleSingleStep(void *ctx) {
+	SContext *context = (SContext *)ctx;
+	MemWatchSpinGuard guard(true);
+	if (g_memWatchStepping == 0)
+		return false;
+
+	context->CTX_FLAGS &= ~TRAP_FLAG;
+	if (g_memWatchPendingRead.valid && g_memWatchPendingRead.thread == std::this_thread::get_id()) {
+		const MemWatchPendingRead &read = g_memWatchPendingRead;
+		MemWatch_QueueHit(MemWatchHit{ read.addr, std::min(read.size, (int)sizeof(MemWatchHit::oldValue)), read.pc, false, true });
+		g_memWatchPendingRead.valid = false;
+	}
+	if (g_memWatchSteppingWriteValid && g_memWatchSteppingWriteThread == std::this_thread::get_id()) {
+		MemWatchHit &hit = g_memWatchSteppingWrite;
+		if (g_memWatchSteppingWriteCompare)
+			hit.changed = memcmp(hit.oldValue, base + hit.addr, hit.size) != 0;
+		MemWatch_QueueHit(hit);
+		g_memWatchSteppingWriteValid = false;
+	}
+
+	if (--g_memWatchStepping == 0) {
+		for (size_t i = 0; i < g_memWatchLiftedCount; ++i) {
+			// Might not be watched anymore.
+			u32 addr = g_memWatchLifted[i];
+			const MemWatchPage *page = MemWatch_FindPage(addr);
+			if (page)
+				ProtectMemoryPages(base + addr, g_memWatchPageSize, page->prot);
+		}
+		g_memWatchLiftedCount = 0;
+	}
+	return true;
+}
+
+#else
+
+bool HandleSingleStep(void *ctx) {
+	return false;
+}
+
+#endif
+
 bool HandleFault(uintptr_t hostAddress, void *ctx) {
+#ifdef MEMWATCH_SUPPORTED
+	if (g_memWatchActive && MemWatch_HandleFault(hostAddress, (SContext *)ctx))
+		return true;
+#endif
+
 	if (inCrashHandler)
 		return false;
 	inCrashHandler = true;
@@ -323,6 +735,10 @@ bool HandleFault(uintptr_t hostAddress, void *ctx) {
 	return false;
 }
 
+bool HandleSingleStep(void *ctx) {
+	return false;
+}
+
 #endif
 
 }  // namespace Memory
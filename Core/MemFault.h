@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <vector>
 
+#include "Common/CommonTypes.h"
 #include "Core/MIPS/MIPSStackWalk.h"
 
 namespace Memory {
@@ -19,6 +22,34 @@ void MemFault_IgnoreLastCrash();
 // Called by exception handlers. We simply filter out accesses to PSP RAM and otherwise
 // just leave it as-is.
 bool HandleFault(uintptr_t hostAddress, void *context);
+bool HandleSingleStep(void *context);
+
+struct MemWatchRange {
+	u32 start;
+	// Exclusive.
+	u32 end;
+	// If false, only writes fault.
+	bool read;
+};
+
+// Memory checks through host page protection, so jitted code doesn't need to check every access.
+// Returns false if unsupported or the ranges cover too many pages, then the jit needs to check instead.
+// Call with an empty list to stop.
+bool MemWatch_SetRanges(const std::vector<MemWatchRange> &ranges);
+bool MemWatch_IsActive();
+// While active, the jit calls this before each memory access, so faults report the exact PC.
+void MemWatch_MapCode(const u8 *hostPtr, u32 guestPC);
+
+extern std::atomic<bool> g_memWatchHasHits;
+
+inline bool MemWatch_HasHits() {
+	return g_memWatchHasHits.load(std::memory_order_relaxed);
+}
+
+// Faults only queue hits, this runs the memchecks for them.  Called on the emu thread from CoreTiming::Advance().
+// So the PC and address reported are exact, but a memcheck that breaks stops the CPU a little later
+// than the access (at the next timing check, usually the end of the block), not at the faulting instruction.
+void MemWatch_ReportHits();
 
 }
 
@@ -0,0 +1,231 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#include "ppsspp_config.h"
+
+#if !PPSSPP_PLATFORM(WINDOWS) && !PPSSPP_PLATFORM(ANDROID) && !defined(__LIBRETRO__) && !PPSSPP_PLATFORM(SWITCH)
+#define HAVE_SHARED_CACHE 1
+#include <cerrno>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#endif
+#if PPSSPP_PLATFORM(LINUX)
+#include <dirent.h>
+#include <cstring>
+#endif
+
+#include <atomic>
+#include <mutex>
+
+#include "Common/Log.h"
+#include "Common/StringUtils.h"
+#include "Common/TimeUtil.h"
+#include "Core/SharedCache.h"
+
+static const uint32_t SHARED_CACHE_MAGIC = 0x48535050;  // PPSH
+static const uint32_t SHARED_CACHE_VERSION = 2;
+
+struct SharedCacheHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint64_t dataSize;
+	// Set by the creator once the fields above are valid.
+	std::atomic<uint32_t> ready;
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared memory atomics must be lock free");
+
+// Keep the data cache line aligned.
+static const size_t HEADER_SIZE = (sizeof(SharedCacheHeader) + 63) & ~(size_t)63;
+
+#if HAVE_SHARED_CACHE
+
+// Every process using a segment holds a shared flock on it for as long as it does, and the creator
+// holds an exclusive one until it's ready.  Locks go away when a process dies, so a segment nobody
+// has locked is garbage, no matter how it got left behind.
+
+// If the creator of a segment died before it was ready, nobody can use it, so it needs to go.
+// The creator holds a lock on it until it's ready, and locks are dropped when a process dies.
+static bool IsAbandoned(int fd, const SharedCacheHeader *header) {
+	if (flock(fd, LOCK_EX | LOCK_NB) != 0)
+		return false;
+	bool abandoned = header == nullptr || header->ready.load(std::memory_order_acquire) == 0;
+	flock(fd, LOCK_UN);
+	return abandoned;
+}
+
+// The name might have been unlinked and reused since fd was opened.
+static bool NameRefersTo(const std::string &name, int fd) {
+	int nameFd = shm_open(name.c_str(), O_RDONLY, 0);
+	if (nameFd < 0)
+		return false;
+	struct stat a{}, b{};
+	bool same = fstat(fd, &a) == 0 && fstat(nameFd, &b) == 0 && a.st_dev == b.st_dev && a.st_ino == b.st_ino;
+	close(nameFd);
+	return same;
+}
+
+// Removes segments left behind by crashed processes.  Only Linux lets us list them, in /dev/shm.
+static void RemoveStaleSegments() {
+#if PPSSPP_PLATFORM(LINUX)
+	DIR *dir = opendir("/dev/shm");
+	if (!dir)
+		return;
+	while (struct dirent *entry = readdir(dir)) {
+		if (strncmp(entry->d_name, "ppsspp_", 7) != 0)
+			continue;
+		std::string name = std::string("/") + entry->d_name;
+		int fd = shm_open(name.c_str(), O_RDWR, 0);
+		if (fd < 0)
+			continue;
+		if (flock(fd, LOCK_EX | LOCK_NB) == 0 && NameRefersTo(name, fd)) {
+			INFO_LOG(Log::IO, "Removing stale shared cache %s", name.c_str());
+			shm_unlink(name.c_str());
+		}
+		close(fd);
+	}
+	closedir(dir);
+#endif
+}
+
+#endif
+
+SharedCacheSegment *SharedCacheSegment::Open(const char *kind, uint64_t key, size_t dataSize) {
+#if HAVE_SHARED_CACHE
+	std::string name = StringFromFormat("/ppsspp_%s_%016llx", kind, (unsigned long long)key);
+	size_t totalSize = HEADER_SIZE + dataSize;
+
+	static std::once_flag removedStale;
+	std::call_once(removedStale, &RemoveStaleSegments);
+
+	// We retry once, after removing an abandoned segment.
+	for (int attempt = 0; attempt < 2; ++attempt) {
+		bool attached = false;
+		int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+		if (fd < 0 && errno == EEXIST) {
+			fd = shm_open(name.c_str(), O_RDWR, 0);
+			attached = true;
+		}
+		if (fd < 0) {
+			WARN_LOG(Log::IO, "Unable to open shared cache %s: %d", name.c_str(), errno);
+			return nullptr;
+		}
+
+		if (!attached) {
+			// Held until the header is ready, see IsAbandoned().  Might not be supported, that's okay.
+			flock(fd, LOCK_EX);
+			// Zero fills, so all blocks start out empty.
+			if (ftruncate(fd, (off_t)totalSize) != 0) {
+				WARN_LOG(Log::IO, "Unable to size shared cache %s to %lld bytes", name.c_str(), (long long)totalSize);
+				shm_unlink(name.c_str());
+				close(fd);
+				return nullptr;
+			}
+		} else {
+			// The creator might not have sized it yet, give it a moment.
+			struct stat st{};
+			for (int tries = 0; tries < 100; ++tries) {
+				if (fstat(fd, &st) != 0 || (size_t)st.st_size == totalSize)
+					break;
+				sleep_ms(1, "shared-cache-size");
+			}
+			// Sized means the creator has its exclusive lock, so this waits until it's ready (or died.)
+			if ((size_t)st.st_size == totalSize)
+				flock(fd, LOCK_SH);
+			if ((size_t)st.st_size != totalSize) {
+				bool abandoned = st.st_size == 0 && IsAbandoned(fd, nullptr);
+				close(fd);
+				if (abandoned) {
+					WARN_LOG(Log::IO, "Removing abandoned shared cache %s", name.c_str());
+					shm_unlink(name.c_str());
+					continue;
+				}
+				WARN_LOG(Log::IO, "Shared cache %s has unexpected size, not using it", name.c_str());
+				return nullptr;
+			}
+		}
+
+		void *base = mmap(nullptr, totalSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		if (base == MAP_FAILED) {
+			WARN_LOG(Log::IO, "Unable to map shared cache %s", name.c_str());
+			if (!attached)
+				shm_unlink(name.c_str());
+			close(fd);
+			return nullptr;
+		}
+
+		SharedCacheHeader *header = (SharedCacheHeader *)base;
+		if (!attached) {
+			header->magic = SHARED_CACHE_MAGIC;
+			header->version = SHARED_CACHE_VERSION;
+			header->key = key;
+			header->dataSize = dataSize;
+			header->ready.store(1, std::memory_order_release);
+			flock(fd, LOCK_SH);
+		} else {
+			for (int tries = 0; tries < 100 && header->ready.load(std::memory_order_acquire) == 0; ++tries)
+				sleep_ms(1, "shared-cache-ready");
+			bool valid = header->ready.load(std::memory_order_acquire) != 0;
+			if (!valid || header->magic != SHARED_CACHE_MAGIC || header->version != SHARED_CACHE_VERSION || header->key != key || header->dataSize != dataSize) {
+				bool abandoned = !valid && IsAbandoned(fd, header);
+				munmap(base, totalSize);
+				close(fd);
+				if (abandoned) {
+					WARN_LOG(Log::IO, "Removing abandoned shared cache %s", name.c_str());
+					shm_unlink(name.c_str());
+					continue;
+				}
+				WARN_LOG(Log::IO, "Shared cache %s is incompatible, not using it", name.c_str());
+				return nullptr;
+			}
+		}
+
+		INFO_LOG(Log::IO, "%s shared cache %s (%lld bytes)", attached ? "Attached to" : "Created", name.c_str(), (long long)dataSize);
+
+		SharedCacheSegment *segment = new SharedCacheSegment();
+		segment->name_ = name;
+		segment->fd_ = fd;
+		segment->base_ = base;
+		segment->totalSize_ = totalSize;
+		segment->data_ = (uint8_t *)base + HEADER_SIZE;
+		segment->dataSize_ = dataSize;
+		segment->attached_ = attached;
+		return segment;
+	}
+	return nullptr;
+#else
+	return nullptr;
+#endif
+}
+
+SharedCacheSegment::~SharedCacheSegment() {
+#if HAVE_SHARED_CACHE
+	if (!base_)
+		return;
+	// If nobody else holds a lock, we're the last user.  If a process crashes instead, the next
+	// one to start up removes the segment (see RemoveStaleSegments), or reuses it if the file is the same.
+	if (flock(fd_, LOCK_EX | LOCK_NB) == 0 && NameRefersTo(name_, fd_))
+		shm_unlink(name_.c_str());
+	munmap(base_, totalSize_);
+	close(fd_);
+#endif
+}
@@ -0,0 +1,63 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Shared memory segments for data that several PPSSPP processes on the same host can share,
+// like the blocks of a RAM cached ISO. Each segment is named by a kind and a key. The key has to
+// identify the contents, since processes that agree on it will use each other's data.
+//
+// The data area starts zeroed. Users are responsible for publishing what they write, for
+// example with per-block atomic flags inside the data. Only POSIX shm is supported.
+//
+// Segments are removed when the last process using them closes them. Ones left behind by
+// crashes are removed the next time a process opens any segment, on Linux. Elsewhere they
+// stay until reboot, unless a later process with the same key picks them up.
+class SharedCacheSegment {
+public:
+	~SharedCacheSegment();
+
+	// Returns nullptr if shared memory isn't available, or an incompatible segment exists.
+	static SharedCacheSegment *Open(const char *kind, uint64_t key, size_t dataSize);
+
+	uint8_t *Data() const {
+		return data_;
+	}
+	size_t DataSize() const {
+		return dataSize_;
+	}
+	// True if another process had already created the segment.
+	bool Attached() const {
+		return attached_;
+	}
+
+private:
+	SharedCacheSegment() {}
+
+	std::string name_;
+	// Kept open to hold a shared lock on the segment while we use it.
+	int fd_ = -1;
+	void *base_ = nullptr;
+	size_t totalSize_ = 0;
+	uint8_t *data_ = nullptr;
+	size_t dataSize_ = 0;
+	bool attached_ = false;
+};
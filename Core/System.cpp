@@ -477,7 +477,7 @@ static bool CPU_Init(FileLoader *fileLoader, IdentifiedFileType type, std::strin
 		g_recentFiles.Add(g_CoreParameter.fileToStart.ToString());
 	}
 
-	InstallExceptionHandler(&Memory::HandleFault);
+	InstallExceptionHandler(&Memory::HandleFault, &Memory::HandleSingleStep);
 	return true;
 }
 
@@ -596,11 +596,11 @@ bool PSP_InitStart(const CoreParameter &coreParam) {
 		g_CoreParameter.fileType = type;
 
 		if (System_GetPropertyBool(SYSPROP_ENOUGH_RAM_FOR_FULL_ISO)) {
-			if (g_Config.bCacheFullIsoInRam) {
+			if (g_Config.bCacheFullIsoInRam || g_Config.bSharedMemoryCache) {
 				switch (g_CoreParameter.fileType) {
 				case IdentifiedFileType::PSP_ISO:
 				case IdentifiedFileType::PSP_ISO_NP:
-					loadedFile = new RamCachingFileLoader(loadedFile);
+					loadedFile = new RamCachingFileLoader(loadedFile, g_Config.bSharedMemoryCache);
 					break;
 				default:
 					INFO_LOG(Log::Loader, "RAM caching is on, but file is not an ISO, so ignoring");
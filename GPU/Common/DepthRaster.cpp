@@ -3,26 +3,23 @@
 #include <cstdint>
 
 #include "Common/Math/CrossSIMD.h"
+#include "Common/Thread/ParallelLoop.h"
 #include "GPU/Common/DepthRaster.h"
 #include "GPU/Math3D.h"
 #include "Common/Math/math_util.h"
 #include "GPU/Common/VertexDecoderCommon.h"
 
-DepthScissor DepthScissor::Tile(int tile, int numTiles) const {
-	if (numTiles == 1) {
-		return *this;
-	}
-	// First tiling algorithm: Split into vertical slices.
-	int w = x2 - x1;
-	int tileW = (w / numTiles) & ~3;  // Round to four pixels.
-
-	// TODO: Should round x1 to four pixels as well! except the first one
-
-	DepthScissor scissor;
-	scissor.x1 = x1 + tileW * tile;
-	scissor.x2 = (tile == numTiles - 1) ? x2 : (x1 + tileW * (tile + 1));
-	scissor.y1 = y1;
-	scissor.y2 = y2;
+// Below this, waking up threads costs more than it saves.
+constexpr int MIN_PARALLEL_VERTS = 384;
+constexpr int MIN_TILE_WIDTH = 64;
+
+DepthScissor DepthScissor::Tile(int tile, int tileWidth) const {
+	// Vertical slices, since rows are contiguous in memory and lowQ writes two rows at once.
+	// The raster loop rounds x down to four pixels, so as long as tileWidth is a multiple of four,
+	// no two tiles ever touch the same pixels.
+	DepthScissor scissor = *this;
+	scissor.x1 = (u16)std::max((int)x1, tile * tileWidth);
+	scissor.x2 = (u16)std::min((int)x2, tile * tileWidth + tileWidth - 1);
 	return scissor;
 }
 
@@ -97,7 +94,7 @@ constexpr int MIN_TWICE_TRI_AREA = 10;
 
 // A mix of ideas from Intel's sample and ryg's rasterizer blog series.
 template<ZCompareMode compareMode, bool lowQ>
-void DepthRaster4Triangles(int stats[3], uint16_t *depthBuf, int stride, DepthScissor scissor, const int *tx, const int *ty, const float *tz) {
+void DepthRaster4Triangles(int *stats, uint16_t *depthBuf, int stride, DepthScissor drawScissor, DepthScissor scissor, const int *tx, const int *ty, const float *tz) {
 	// Triangle setup. This is done using SIMD, four triangles at a time.
 	// 16x16->32 multiplications are doable on SSE2, which should be all we need.
 
@@ -118,13 +115,30 @@ void DepthRaster4Triangles(int stats[3], uint16_t *depthBuf, int stride, DepthSc
 	}
 
 	// FixupAfterMinMax is just 16->32 sign extension, in case the current platform (like SSE2) just has 16-bit min/max operations.
-	Vec4S32 minX = x0.Min16(x1).Min16(x2).Max16(Vec4S32::Splat(scissor.x1)).FixupAfterMinMax();
-	Vec4S32 maxX = x0.Max16(x1).Max16(x2).Min16(Vec4S32::Splat(scissor.x2)).FixupAfterMinMax();
+	// Tiles are columns, so they only change the X range.  Rejection still goes by the whole draw,
+	// so that tiling doesn't change which triangles get drawn.
+	Vec4S32 drawMinX = x0.Min16(x1).Min16(x2).Max16(Vec4S32::Splat(drawScissor.x1)).FixupAfterMinMax();
+	Vec4S32 drawMaxX = x0.Max16(x1).Max16(x2).Min16(Vec4S32::Splat(drawScissor.x2)).FixupAfterMinMax();
+	Vec4S32 minX = drawMinX.Max16(Vec4S32::Splat(scissor.x1)).FixupAfterMinMax();
+	Vec4S32 maxX = drawMaxX.Min16(Vec4S32::Splat(scissor.x2)).FixupAfterMinMax();
 	Vec4S32 minY = y0.Min16(y1).Min16(y2).Max16(Vec4S32::Splat(scissor.y1)).FixupAfterMinMax();
 	Vec4S32 maxY = y0.Max16(y1).Max16(y2).Min16(Vec4S32::Splat(scissor.y2)).FixupAfterMinMax();
 
 	Vec4S32 triArea = (x1 - x0).Mul16(y2 - y0) - (x2 - x0).Mul16(y1 - y0);
 
+	// When tiled, only one tile counts stats.
+	if (stats) {
+		for (int t = 0; t < 4; t++) {
+			if (drawMaxX[t] <= drawMinX[t] || maxY[t] <= minY[t]) {
+				stats[(int)TriangleStat::NoPixels]++;
+			} else if (triArea[t] < MIN_TWICE_TRI_AREA) {
+				stats[(int)TriangleStat::SmallOrBackface]++;  // Or zero area.
+			} else {
+				stats[(int)TriangleStat::OK]++;
+			}
+		}
+	}
+
 	// Edge setup
 	Vec4S32 A12 = y1 - y2;
 	Vec4S32 B12 = x2 - x1;
@@ -164,27 +178,28 @@ void DepthRaster4Triangles(int stats[3], uint16_t *depthBuf, int stride, DepthSc
 	for (int t = 0; t < 4; t++) {
 		// Check for bad triangle.
 		// Using operator[] on the vectors actually seems to result in pretty good code.
-		if (maxX[t] <= minX[t] || maxY[t] <= minY[t]) {
-			// No pixels, or outside screen.
+		if (drawMaxX[t] <= drawMinX[t] || maxY[t] <= minY[t] || maxX[t] < minX[t]) {
+			// No pixels, or outside screen (or this tile.)
 			// Most of these are now gone in the initial pass, but not all since we cull
 			// in 4-groups there.
-			stats[(int)TriangleStat::NoPixels]++;
 			continue;
 		}
 
 		if (triArea[t] < MIN_TWICE_TRI_AREA) {
-			stats[(int)TriangleStat::SmallOrBackface]++;  // Or zero area.
 			continue;
 		}
 
 		const int minXT = minX[t] & ~3;
 		const int maxXT = maxX[t] & ~3;
+		// Z accumulates rounding as it steps, so always step from where the whole triangle starts.
+		// That way, each tile gets exactly the same Z as drawing untiled.
+		const int startXT = drawMinX[t] & ~3;
 
 		const int minYT = minY[t];
 		const int maxYT = maxY[t];
 
 		// Convert to wide registers.
-		Vec4S32 initialX = Vec4S32::Splat(minXT) + Vec4S32::LoadAligned(zero123);
+		Vec4S32 initialX = Vec4S32::Splat(startXT) + Vec4S32::LoadAligned(zero123);
 		int initialY = minY[t];
 		_dbg_assert_(A12[t] < 32767);
 		_dbg_assert_(A12[t] > -32767);
@@ -218,7 +233,10 @@ void DepthRaster4Triangles(int stats[3], uint16_t *depthBuf, int stride, DepthSc
 
 			uint16_t *rowPtr = depthBuf + stride * y;
 
-			for (int x = minXT; x <= maxXT; x += stepXSize, w0 += oneStepX12, w1 += oneStepX20, w2 += oneStepX01, zs += zdeltaX) {
+			for (int x = startXT; x <= maxXT; x += stepXSize, w0 += oneStepX12, w1 += oneStepX20, w2 += oneStepX01, zs += zdeltaX) {
+				if (x < minXT)
+					continue;
+
 				// If p is on or inside all edges for any pixels,
 				// render those pixels.
 				Vec4S32 signCalc = w0 | w1 | w2;
@@ -258,8 +276,6 @@ void DepthRaster4Triangles(int stats[3], uint16_t *depthBuf, int stride, DepthSc
 				}
 			}
 		}
-
-		stats[(int)TriangleStat::OK]++;
 	}
 }
 
@@ -555,8 +571,8 @@ int DepthRasterClipIndexedTriangles(int *tx, int *ty, float *tz, const float *tr
 	return outCount;
 }
 
-// Rasterizes screen-space vertices.
-void DepthRasterScreenVerts(uint16_t *depth, int depthStride, const int *tx, const int *ty, const float *tz, int count, const DepthDraw &draw, const DepthScissor scissor, bool lowQ) {
+// Rasterizes screen-space vertices.  Counts into stats (indexed by TriangleStat), unless it's null.
+static void RasterScreenVerts(uint16_t *depth, int depthStride, const int *tx, const int *ty, const float *tz, int count, const DepthDraw &draw, const DepthScissor scissor, bool lowQ, int *stats) {
 	// Prim should now be either TRIANGLES or RECTs.
 	_dbg_assert_(draw.prim == GE_PRIM_RECTANGLES || draw.prim == GE_PRIM_TRIANGLES);
 
@@ -568,32 +584,32 @@ void DepthRasterScreenVerts(uint16_t *depth, int depthStride, const int *tx, con
 			// We remove the subpixel information here.
 			DepthRasterRect(depth, depthStride, scissor, tx[i], ty[i], tx[i + 1], ty[i + 1], z, draw.compareMode);
 		}
-		gpuStats.numDepthRasterPrims += count / 2;
+		if (stats)
+			stats[(int)TriangleStat::OK] += count / 2;
 		break;
 	case GE_PRIM_TRIANGLES:
 	{
-		int stats[3]{};
 		// Batches of 4 triangles, as output by the clip function.
 		if (lowQ) {
 			switch (draw.compareMode) {
 			case ZCompareMode::Greater:
 			{
 				for (int i = 0; i < count; i += 12) {
-					DepthRaster4Triangles<ZCompareMode::Greater, true>(stats, depth, depthStride, scissor, &tx[i], &ty[i], &tz[i]);
+					DepthRaster4Triangles<ZCompareMode::Greater, true>(stats, depth, depthStride, draw.scissor, scissor, &tx[i], &ty[i], &tz[i]);
 				}
 				break;
 			}
 			case ZCompareMode::Less:
 			{
 				for (int i = 0; i < count; i += 12) {
-					DepthRaster4Triangles<ZCompareMode::Less, true>(stats, depth, depthStride, scissor, &tx[i], &ty[i], &tz[i]);
+					DepthRaster4Triangles<ZCompareMode::Less, true>(stats, depth, depthStride, draw.scissor, scissor, &tx[i], &ty[i], &tz[i]);
 				}
 				break;
 			}
 			case ZCompareMode::Always:
 			{
 				for (int i = 0; i < count; i += 12) {
-					DepthRaster4Triangles<ZCompareMode::Always, true>(stats, depth, depthStride, scissor, &tx[i], &ty[i], &tz[i]);
+					DepthRaster4Triangles<ZCompareMode::Always, true>(stats, depth, depthStride, draw.scissor, scissor, &tx[i], &ty[i], &tz[i]);
 				}
 				break;
 			}
@@ -603,32 +619,86 @@ void DepthRasterScreenVerts(uint16_t *depth, int depthStride, const int *tx, con
 			case ZCompareMode::Greater:
 			{
 				for (int i = 0; i < count; i += 12) {
-					DepthRaster4Triangles<ZCompareMode::Greater, false>(stats, depth, depthStride, scissor, &tx[i], &ty[i], &tz[i]);
+					DepthRaster4Triangles<ZCompareMode::Greater, false>(stats, depth, depthStride, draw.scissor, scissor, &tx[i], &ty[i], &tz[i]);
 				}
 				break;
 			}
 			case ZCompareMode::Less:
 			{
 				for (int i = 0; i < count; i += 12) {
-					DepthRaster4Triangles<ZCompareMode::Less, false>(stats, depth, depthStride, scissor, &tx[i], &ty[i], &tz[i]);
+					DepthRaster4Triangles<ZCompareMode::Less, false>(stats, depth, depthStride, draw.scissor, scissor, &tx[i], &ty[i], &tz[i]);
 				}
 				break;
 			}
 			case ZCompareMode::Always:
 			{
 				for (int i = 0; i < count; i += 12) {
-					DepthRaster4Triangles<ZCompareMode::Always, false>(stats, depth, depthStride, scissor, &tx[i], &ty[i], &tz[i]);
+					DepthRaster4Triangles<ZCompareMode::Always, false>(stats, depth, depthStride, draw.scissor, scissor, &tx[i], &ty[i], &tz[i]);
 				}
 				break;
 			}
 			}
 		}
-		gpuStats.numDepthRasterNoPixels += stats[(int)TriangleStat::NoPixels];
-		gpuStats.numDepthRasterTooSmall += stats[(int)TriangleStat::SmallOrBackface];
-		gpuStats.numDepthRasterPrims += stats[(int)TriangleStat::OK];
 		break;
 	}
 	default:
 		_dbg_assert_(false);
 	}
 }
+
+static void AddDepthRasterStats(const int *stats) {
+	gpuStats.numDepthRasterNoPixels += stats[(int)TriangleStat::NoPixels];
+	gpuStats.numDepthRasterTooSmall += stats[(int)TriangleStat::SmallOrBackface];
+	gpuStats.numDepthRasterPrims += stats[(int)TriangleStat::OK];
+}
+
+void DepthRasterScreenVerts(uint16_t *depth, int depthStride, const int *tx, const int *ty, const float *tz, int count, const DepthDraw &draw, const DepthScissor scissor, bool lowQ) {
+	int stats[3]{};
+	RasterScreenVerts(depth, depthStride, tx, ty, tz, count, draw, scissor, lowQ, stats);
+	AddDepthRasterStats(stats);
+}
+
+void DepthRasterScreenDraws(const DepthScreenDraw *draws, int numDraws, const int *tx, const int *ty, const float *tz, bool lowQ) {
+	int width = 0;
+	int totalVerts = 0;
+	for (int i = 0; i < numDraws; i++) {
+		width = std::max(width, draws[i].draw->scissor.x2 + 1);
+		totalVerts += draws[i].count;
+	}
+
+	// Each tile runs through all the draws in order, so ordering between draws is kept.
+	// Stats are counted per tile (by the first tile of each draw), and summed up afterwards.
+	struct TileStats {
+		int stats[3];
+	};
+	std::vector<TileStats> tileStats;
+	auto rasterTiles = [&](int tileWidth, int lower, int upper) {
+		for (int tile = lower; tile < upper; tile++) {
+			for (int i = 0; i < numDraws; i++) {
+				const DepthScreenDraw &screen = draws[i];
+				const DepthDraw &draw = *screen.draw;
+				DepthScissor scissor = draw.scissor.Tile(tile, tileWidth);
+				if (scissor.Empty())
+					continue;
+				int *stats = tile == draw.scissor.x1 / tileWidth ? tileStats[tile].stats : nullptr;
+				RasterScreenVerts(screen.depth, draw.depthStride, tx + screen.offset, ty + screen.offset, tz + screen.offset, screen.count, draw, scissor, lowQ, stats);
+			}
+		}
+	};
+
+	const int threads = g_threadManager.GetNumLooperThreads();
+	if (threads <= 1 || totalVerts < MIN_PARALLEL_VERTS || width < MIN_TILE_WIDTH * 2) {
+		tileStats.resize(1);
+		rasterTiles(std::max(width, 4), 0, 1);
+	} else {
+		const int tileWidth = std::max(MIN_TILE_WIDTH, ((width + threads - 1) / threads + 3) & ~3);
+		const int numTiles = (width + tileWidth - 1) / tileWidth;
+		tileStats.resize(numTiles);
+		ParallelRangeLoop(&g_threadManager, [&](int lower, int upper) {
+			rasterTiles(tileWidth, lower, upper);
+		}, 0, numTiles, 1);
+	}
+
+	for (const TileStats &tile : tileStats)
+		AddDepthRasterStats(tile.stats);
+}
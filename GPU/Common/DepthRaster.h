@@ -27,7 +27,11 @@ struct DepthScissor {
 	u16 x2;
 	u16 y2;
 
-	DepthScissor Tile(int tile, int numTiles) const;
+	bool Empty() const {
+		return x1 > x2 || y1 > y2;
+	}
+	// Clips to a screen column.  Keep tileWidth a multiple of 4 so tiles never share a SIMD group.
+	DepthScissor Tile(int tile, int tileWidth) const;
 };
 
 struct DepthDraw {
@@ -43,6 +47,14 @@ struct DepthDraw {
 	int vertexCount;
 };
 
+// A draw's clipped screen verts, at offset in the tx/ty/tz arrays.
+struct DepthScreenDraw {
+	const DepthDraw *draw;
+	uint16_t *depth;
+	int offset;
+	int count;
+};
+
 // Specialized, very limited depth-only rasterizer.
 // Meant to run in parallel with hardware rendering, in games that read back the depth buffer
 // for effects like lens flare.
@@ -57,3 +69,5 @@ void DecodeAndTransformForDepthRaster(float *dest, const float *worldviewproj, c
 void TransformPredecodedForDepthRaster(float *dest, const float *worldviewproj, const void *decodedVertexData, const VertexDecoder *dec, int count);
 void ConvertPredecodedThroughForDepthRaster(float *dest, const void *decodedVertexData, const VertexDecoder *dec, int count);
 void DepthRasterScreenVerts(uint16_t *depth, int depthStride, const int *tx, const int *ty, const float *tz, int count, const DepthDraw &draw, const DepthScissor scissor, bool lowQ);
+// Rasterizes a batch of clipped draws in order, split into screen columns across threads when it's worth it.
+void DepthRasterScreenDraws(const DepthScreenDraw *draws, int numDraws, const int *tx, const int *ty, const float *tz, bool lowQ);
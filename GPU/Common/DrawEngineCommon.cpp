@@ -48,6 +48,7 @@ DrawEngineCommon::DrawEngineCommon() : decoderMap_(32) {
 	decoded_ = (u8 *)AllocateMemoryPages(DECODED_VERTEX_BUFFER_SIZE, MEM_PROT_READ | MEM_PROT_WRITE);
 	decIndex_ = (u16 *)AllocateMemoryPages(DECODED_INDEX_BUFFER_SIZE, MEM_PROT_READ | MEM_PROT_WRITE);
 	indexGen.Setup(decIndex_);
+	tessCache_ = new Spline::TessellationCache();
 
 	InitDepthRaster();
 }
@@ -59,6 +60,7 @@ DrawEngineCommon::~DrawEngineCommon() {
 	FreeMemoryPages(transformedExpanded_, 3 * TRANSFORMED_VERTEX_BUFFER_SIZE);
 	ShutdownDepthRaster();
 	delete decJitCache_;
+	delete tessCache_;
 	decoderMap_.Iterate([&](const uint32_t vtype, VertexDecoder *decoder) {
 		delete decoder;
 	});
@@ -1126,37 +1128,56 @@ void DrawEngineCommon::FlushQueuedDepth() {
 	const bool collectStats = coreCollectDebugStats;
 	const bool lowQ = g_Config.iDepthRasterMode == (int)DepthRasterMode::LOW_QUALITY;
 
+	int *tx = depthScreenVerts_;
+	int *ty = depthScreenVerts_ + DEPTH_SCREENVERTS_COMPONENT_COUNT;
+	float *tz = (float *)(depthScreenVerts_ + DEPTH_SCREENVERTS_COMPONENT_COUNT * 2);
+
+	// Clip draws one after another into the screen vert arrays, and rasterize them in batches.
+	// That way, threads only need to be woken up once per batch rather than once per draw.
+	auto rasterizeBatch = [&]() {
+		TimeCollector collectStat(&gpuStats.msRasterizeDepth, collectStats);
+		DepthRasterScreenDraws(depthScreenDraws_.data(), (int)depthScreenDraws_.size(), tx, ty, tz, lowQ);
+		depthScreenDraws_.clear();
+	};
+
+	int offset = 0;
 	for (const auto &draw : depthDraws_) {
-		int *tx = depthScreenVerts_;
-		int *ty = depthScreenVerts_ + DEPTH_SCREENVERTS_COMPONENT_COUNT;
-		float *tz = (float *)(depthScreenVerts_ + DEPTH_SCREENVERTS_COMPONENT_COUNT * 2);
+		// Worst case, the last group of four triangles is padded, and culling off stores each twice.
+		int maxVertCount = draw.prim == GE_PRIM_TRIANGLES ? draw.vertexCount * 2 + 24 : draw.vertexCount;
+		if (offset != 0 && offset + maxVertCount > DEPTH_SCREENVERTS_COMPONENT_COUNT) {
+			rasterizeBatch();
+			offset = 0;
+		}
 
 		int outVertCount = 0;
 
 		const float *vertices = depthTransformed_ + 4 * draw.vertexOffset;
 		const uint16_t *indices = depthIndices_ + draw.indexOffset;
 
-		DepthScissor tileScissor = draw.scissor.Tile(0, 1);
-
 		{
 			TimeCollector collectStat(&gpuStats.msCullDepth, collectStats);
 			switch (draw.prim) {
 			case GE_PRIM_RECTANGLES:
-				outVertCount = DepthRasterClipIndexedRectangles(tx, ty, tz, vertices, indices, draw, tileScissor);
+				outVertCount = DepthRasterClipIndexedRectangles(tx + offset, ty + offset, tz + offset, vertices, indices, draw, draw.scissor);
 				break;
 			case GE_PRIM_TRIANGLES:
-				outVertCount = DepthRasterClipIndexedTriangles(tx, ty, tz, vertices, indices, draw, tileScissor);
+				outVertCount = DepthRasterClipIndexedTriangles(tx + offset, ty + offset, tz + offset, vertices, indices, draw, draw.scissor);
 				break;
 			default:
 				_dbg_assert_(false);
 				break;
 			}
 		}
-		{
-			TimeCollector collectStat(&gpuStats.msRasterizeDepth, collectStats);
-			DepthRasterScreenVerts((uint16_t *)Memory::GetPointerWrite(draw.depthAddr), draw.depthStride, tx, ty, tz, outVertCount, draw, tileScissor, lowQ);
+
+		if (outVertCount != 0) {
+			uint16_t *depth = (uint16_t *)Memory::GetPointerWrite(draw.depthAddr);
+			depthScreenDraws_.push_back(DepthScreenDraw{ &draw, depth, offset, outVertCount });
+			// Keep the next draw aligned for SIMD loads.
+			offset += (outVertCount + 3) & ~3;
 		}
 	}
+	if (!depthScreenDraws_.empty())
+		rasterizeBatch();
 
 	// Reset queue
 	depthIndexCount_ = 0;
@@ -30,6 +30,11 @@
 
 class VertexDecoder;
 struct DepthDraw;
+struct DepthScreenDraw;
+
+namespace Spline {
+class TessellationCache;
+}
 
 enum {
 	VERTEX_BUFFER_MAX = 65536,
@@ -349,6 +354,8 @@ class DrawEngineCommon {
 
 	// Hardware tessellation
 	TessellationDataTransfer *tessDataTransfer;
+	// Software tessellation results from previous frames.
+	Spline::TessellationCache *tessCache_ = nullptr;
 
 	// Culling
 	Plane8 planes_;
@@ -369,6 +376,7 @@ class DrawEngineCommon {
 	int depthVertexCount_ = 0;
 	int depthIndexCount_ = 0;
 	std::vector<DepthDraw> depthDraws_;
+	std::vector<DepthScreenDraw> depthScreenDraws_;
 
 	double rasterTimeStart_ = 0.0;
 };
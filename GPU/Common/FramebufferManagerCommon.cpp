@@ -897,6 +897,7 @@ void FramebufferManagerCommon::CopyToColorFromOverlappingFramebuffers(VirtualFra
 				// OK we have the pipeline, now just do the blit.
 				BlitUsingRaster(src->fbo, 0.0f, 0.0f, srcWidth, srcHeight,
 					dst->fbo, dstX1, dstY1, dstX2, dstY2, false, dst->renderScaleFactor, pipeline, pass_name);
+				SetRowsDirty(dst, 0, 0xFFFF);
 			}
 
 			if (scaleFactorX == 1.0f && dst->z_address == src->z_address && dst->z_stride == src->z_stride) {
@@ -1891,6 +1892,8 @@ void FramebufferManagerCommon::ResizeFramebufFBO(VirtualFramebuffer *vfb, int w,
 	} else {
 		draw_->BindFramebufferAsRenderTarget(vfb->fbo, { Draw::RPAction::CLEAR, Draw::RPAction::CLEAR, Draw::RPAction::CLEAR }, "ResizeFramebufFBO");
 	}
+	// Whatever was copied over, it might not match memory anymore.
+	SetRowsDirty(vfb, 0, 0xFFFF);
 	DiscardFramebufferCopy();
 	currentRenderVfb_ = vfb;
 
@@ -2160,7 +2163,7 @@ bool FramebufferManagerCommon::NotifyFramebufferCopy(u32 src, u32 dst, int size,
 			WARN_LOG_ONCE(dstnotsrccpy, Log::FrameBuf, "Inter-buffer memcpy %08x -> %08x (size: %x)", src, dst, size);
 			// Just do the blit!
 			BlitFramebuffer(dstBuffer, 0, dstY, srcBuffer, 0, srcY, srcBuffer->width, srcH, 0, channel, "Blit_InterBufferMemcpy");
-			SetColorUpdated(dstBuffer, skipDrawReason);
+			SetColorUpdated(dstBuffer, skipDrawReason, dstY, dstY + srcH);
 			RebindFramebuffer("RebindFramebuffer - Inter-buffer memcpy");
 		}
 		return false;
@@ -2178,7 +2181,7 @@ bool FramebufferManagerCommon::NotifyFramebufferCopy(u32 src, u32 dst, int size,
 		GEBufferFormat srcFormat = channel == RASTER_DEPTH ? GE_FORMAT_DEPTH16 : dstBuffer->fb_format;
 		int srcStride = channel == RASTER_DEPTH ? dstBuffer->z_stride : dstBuffer->fb_stride;
 		DrawPixels(dstBuffer, 0, dstY, srcBase, srcFormat, srcStride, dstBuffer->width, dstH, channel, "MemcpyFboUpload_DrawPixels");
-		SetColorUpdated(dstBuffer, skipDrawReason);
+		SetColorUpdated(dstBuffer, skipDrawReason, dstY, dstY + dstH);
 		RebindFramebuffer("RebindFramebuffer - Memcpy fbo upload");
 		// This is a memcpy, let's still copy just in case.
 		return false;
@@ -2666,7 +2669,7 @@ bool FramebufferManagerCommon::NotifyBlockTransferBefore(u32 dstBasePtr, int dst
 			// Some backends can handle blitting within a framebuffer. Others will just have to deal with it or ignore it, apparently.
 			BlitFramebuffer(dstRect.vfb, dstX, dstY, srcRect.vfb, srcX, srcY, dstRect.w_bytes / bpp, dstRect.h, bpp, dstRect.channel, "Blit_IntraBufferBlockTransfer");
 			RebindFramebuffer("rebind after intra block transfer");
-			SetColorUpdated(dstRect.vfb, skipDrawReason);
+			SetColorUpdated(dstRect.vfb, skipDrawReason, dstRect.y, dstRect.y + dstRect.h);
 			return true;  // Skip the memory copy.
 		}
 
@@ -2688,7 +2691,7 @@ bool FramebufferManagerCommon::NotifyBlockTransferBefore(u32 dstBasePtr, int dst
 			FlushBeforeCopy();
 			BlitFramebuffer(dstRect.vfb, dstRect.x_bytes / bpp, dstRect.y, srcRect.vfb, srcRect.x_bytes / bpp, srcRect.y, srcRect.w_bytes / bpp, height, bpp, srcRect.channel, "Blit_InterBufferBlockTransfer");
 			RebindFramebuffer("RebindFramebuffer - Inter-buffer block transfer");
-			SetColorUpdated(dstRect.vfb, skipDrawReason);
+			SetColorUpdated(dstRect.vfb, skipDrawReason, dstRect.y, dstRect.y + dstRect.h);
 			return true;
 		}
 
@@ -3124,6 +3127,9 @@ void FramebufferManagerCommon::ReadbackFramebuffer(VirtualFramebuffer *vfb, int
 		return;
 	}
 
+	// Any other buffers sharing this memory no longer match it after the download.
+	const VirtualFramebuffer *srcVfb = vfb;
+
 	// Note that ReadbackDepthBufferSync can stretch on its own while converting data format, so we don't need to downscale in that case.
 	if (vfb->renderScaleFactor == 1 || channel == RASTER_DEPTH) {
 		// No need to stretch-blit
@@ -3171,6 +3177,11 @@ void FramebufferManagerCommon::ReadbackFramebuffer(VirtualFramebuffer *vfb, int
 	size_t len = snprintf(tag, sizeof(tag), "FramebufferPack/%08x_%08x_%dx%d_%s", vfb->fb_address, vfb->z_address, w, h, GeBufferFormatToString(vfb->fb_format));
 	NotifyMemInfo(MemBlockFlags::WRITE, fb_address + dstByteOffset, dstSize, tag, len);
 
+	for (VirtualFramebuffer *other : vfbs_) {
+		if (other != srcVfb || channel != RASTER_COLOR)
+			SetRowsDirtyInRange(other, fb_address + dstByteOffset, dstSize);
+	}
+
 	if (mode == Draw::ReadbackMode::BLOCK) {
 		gpuStats.numBlockingReadbacks++;
 	} else {
@@ -3221,6 +3232,14 @@ void FramebufferManagerCommon::ReadFramebufferToMemory(VirtualFramebuffer *vfb,
 		}
 	}
 
+	if (channel == RASTER_COLOR && mode == Draw::ReadbackMode::BLOCK) {
+		// Rows that haven't changed since they were last downloaded are already in memory.
+		if (!ClipReadbackToDirtyRows(vfb, x, w, &y, &h)) {
+			gpuStats.numReadbacksSkipped++;
+			return;
+		}
+	}
+
 	// This handles any required stretching internally.
 	ReadbackFramebuffer(vfb, x, y, w, h, channel, mode);
 
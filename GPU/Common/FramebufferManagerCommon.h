@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #include <unordered_map>
 
@@ -129,6 +130,11 @@ struct VirtualFramebuffer {
 	// Means that the whole image has already been read back to memory - used when combining small readbacks (gameUsesSequentialCopies_).
 	bool memoryUpdated;
 
+	// Rows (in PSP pixels) that may have changed on the GPU since they were last read back to memory.
+	// Blocking color downloads only read these.  Starts out covering everything, since we don't know.
+	u16 dirtyRowsStart = 0;
+	u16 dirtyRowsEnd = 0xFFFF;
+
 	// TODO: Fold into usageFlags?
 	bool dirtyAfterDisplay;
 	bool reallyDirtyAfterDisplay;  // takes frame skipping into account
@@ -172,6 +178,61 @@ struct VirtualFramebuffer {
 	}
 };
 
+inline void SetRowsDirty(VirtualFramebuffer *vfb, int y1, int y2) {
+	if (y2 <= y1)
+		return;
+	if (vfb->dirtyRowsEnd <= vfb->dirtyRowsStart) {
+		vfb->dirtyRowsStart = (u16)y1;
+		vfb->dirtyRowsEnd = (u16)std::min(y2, 0xFFFF);
+	} else {
+		vfb->dirtyRowsStart = std::min(vfb->dirtyRowsStart, (u16)y1);
+		vfb->dirtyRowsEnd = (u16)std::max((int)vfb->dirtyRowsEnd, std::min(y2, 0xFFFF));
+	}
+}
+
+// Rows of the framebuffer a draw clipped to [scissorY1, scissorY2] can touch.  With a large vertical
+// offset (see FramebufferAllowLargeVerticalOffset), drawing lands rtOffsetY rows further down.
+inline void ScissorToDrawnRows(int scissorY1, int scissorY2, int rtOffsetY, int *y1, int *y2) {
+	*y1 = std::max(scissorY1 + rtOffsetY, 0);
+	*y2 = std::max(scissorY2 + 1 + rtOffsetY, 0);
+}
+
+// Only a single range is tracked, so a download in the middle of it doesn't shrink it.
+inline void SetRowsDownloaded(VirtualFramebuffer *vfb, int y1, int y2) {
+	if (y1 <= vfb->dirtyRowsStart && y2 > vfb->dirtyRowsStart)
+		vfb->dirtyRowsStart = (u16)std::min(y2, (int)vfb->dirtyRowsEnd);
+	else if (y2 >= vfb->dirtyRowsEnd && y1 < vfb->dirtyRowsEnd)
+		vfb->dirtyRowsEnd = (u16)std::max(y1, (int)vfb->dirtyRowsStart);
+}
+
+// Something else (like another buffer's download) wrote to [addr, addr + size), so those rows of vfb in memory are stale.
+inline void SetRowsDirtyInRange(VirtualFramebuffer *vfb, u32 addr, u32 size) {
+	const u32 byteStride = (u32)vfb->FbStrideInBytes();
+	const u32 start = vfb->fb_address;
+	const u32 end = start + byteStride * vfb->height;
+	if (byteStride == 0 || addr >= end || addr + size <= start)
+		return;
+	int y1 = addr <= start ? 0 : (int)((addr - start) / byteStride);
+	int y2 = (int)((std::min(addr + size, end) - start + byteStride - 1) / byteStride);
+	SetRowsDirty(vfb, y1, y2);
+}
+
+// Clips a blocking color readback to the rows that might have changed, and marks full width rows as downloaded.
+// Returns false if there's nothing left to read.
+inline bool ClipReadbackToDirtyRows(VirtualFramebuffer *vfb, int x, int w, int *y, int *h) {
+	int y1 = std::max(*y, (int)vfb->dirtyRowsStart);
+	int y2 = std::min(*y + *h, (int)vfb->dirtyRowsEnd);
+	if (x == 0 && x + w >= vfb->width) {
+		// Rows past the height can't be drawn without a resize, which dirties everything anyway.
+		SetRowsDownloaded(vfb, *y, *y + *h >= vfb->height ? 0xFFFF : *y + *h);
+	}
+	if (y2 <= y1)
+		return false;
+	*y = y1;
+	*h = y2 - y1;
+	return true;
+}
+
 struct FramebufferHeuristicParams {
 	u32 fb_address;
 	u32 z_address;
@@ -428,7 +489,10 @@ class FramebufferManagerCommon {
 
 	void SetColorUpdated(int skipDrawReason) {
 		if (currentRenderVfb_) {
-			SetColorUpdated(currentRenderVfb_, skipDrawReason);
+			// Draws can't have touched anything outside the scissor.
+			int y1, y2;
+			ScissorToDrawnRows(gstate.getScissorY1(), gstate.getScissorY2(), gstate_c.curRTOffsetY, &y1, &y2);
+			SetColorUpdated(currentRenderVfb_, skipDrawReason, y1, y2);
 		}
 	}
 	void SetSafeSize(u16 w, u16 h);
@@ -541,7 +605,8 @@ class FramebufferManagerCommon {
 
 	int GetFramebufferLayers() const;
 
-	static void SetColorUpdated(VirtualFramebuffer *dstBuffer, int skipDrawReason) {
+	static void SetColorUpdated(VirtualFramebuffer *dstBuffer, int skipDrawReason, int y1 = 0, int y2 = 0xFFFF) {
+		SetRowsDirty(dstBuffer, y1, y2);
 		dstBuffer->memoryUpdated = false;
 		dstBuffer->clutUpdatedBytes = 0;
 		dstBuffer->dirtyAfterDisplay = true;
@@ -23,7 +23,9 @@
 #include "GPU/Common/DrawEngineCommon.h"
 #include "GPU/Common/SoftwareTransformCommon.h"
 #include "GPU/ge_constants.h"
+#include "GPU/GPU.h"
 #include "GPU/GPUState.h"  // only needed for UVScale stuff
+#include "ext/xxhash.h"
 
 class SimpleBufferManager {
 private:
@@ -474,10 +476,105 @@ static void HardwareTessellation(OutputBuffers &output, const Surface &surface,
 	surface.BuildIndex(output.indices, output.count);
 }
 
+// Entries not drawn for this many frames are dropped.
+static const int TESS_CACHE_MAX_AGE = 30;
+static const size_t TESS_CACHE_MAX_BYTES = 16 * 1024 * 1024;
+
+const TessellationCache::Entry *TessellationCache::Lookup(u64 key) {
+	auto it = entries_.find(key);
+	if (it == entries_.end())
+		return nullptr;
+	it->second.lastFrame = gpuStats.numFlips;
+	return it->second.filled ? &it->second : nullptr;
+}
+
+void TessellationCache::Store(u64 key, const OutputBuffers &output, int vertexCount, u32 vertType) {
+	auto it = entries_.find(key);
+	if (it == entries_.end()) {
+		// First time we see it, just remember the key.
+		Entry &entry = entries_[key];
+		entry.lastFrame = gpuStats.numFlips;
+		return;
+	}
+
+	size_t size = vertexCount * sizeof(SimpleVertex) + output.count * sizeof(u16);
+	Entry &entry = it->second;
+	if (entry.filled || totalBytes_ + size > TESS_CACHE_MAX_BYTES)
+		return;
+
+	entry.vertices.assign(output.vertices, output.vertices + vertexCount);
+	entry.indices.assign(output.indices, output.indices + output.count);
+	entry.vertType = vertType;
+	entry.lastFrame = gpuStats.numFlips;
+	entry.filled = true;
+	totalBytes_ += size;
+}
+
+void TessellationCache::Decimate() {
+	if (lastDecimateFrame_ == gpuStats.numFlips)
+		return;
+	lastDecimateFrame_ = gpuStats.numFlips;
+
+	for (auto it = entries_.begin(); it != entries_.end(); ) {
+		if (it->second.lastFrame + TESS_CACHE_MAX_AGE < gpuStats.numFlips || it->second.lastFrame > gpuStats.numFlips) {
+			totalBytes_ -= it->second.vertices.size() * sizeof(SimpleVertex) + it->second.indices.size() * sizeof(u16);
+			it = entries_.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
 } // namespace Spline
 
 using namespace Spline;
 
+// Hashes everything that affects the software tessellation output, including the control points.
+// Skinning and morphing are left out, so callers must not use this when the vertex type has them.
+template<class Surface>
+static u64 ComputeTessellationKey(const void *control_points, const void *indices, const Surface &surface, u32 vertType, int vertexSize, int num_points, u16 index_upper_bound) {
+	struct {
+		u32 vertType;
+		u32 uvGenMode;
+		u32 materialAmbient;
+		int quality;
+		UVScale uv;
+		int tess_u, tess_v;
+		int num_points_u, num_points_v;
+		int type_u, type_v;
+		int primType;
+		u8 patchFacing;
+		u8 lighting;
+	} state;
+	// Zero the padding too, since it's hashed.
+	memset(&state, 0, sizeof(state));
+
+	state.vertType = vertType;
+	state.uvGenMode = gstate.getUVGenMode();
+	if ((vertType & GE_VTYPE_COL_MASK) == 0)
+		state.materialAmbient = gstate.getMaterialAmbientRGBA();
+	state.quality = g_Config.iSplineBezierQuality;
+	if (vertType & GE_VTYPE_TC_MASK)
+		state.uv = gstate_c.uv;
+	state.tess_u = surface.tess_u;
+	state.tess_v = surface.tess_v;
+	state.num_points_u = surface.num_points_u;
+	state.num_points_v = surface.num_points_v;
+	state.type_u = surface.type_u;
+	state.type_v = surface.type_v;
+	state.primType = surface.primType;
+	state.patchFacing = surface.patchFacing;
+	state.lighting = (vertType & GE_VTYPE_NRM_MASK) == 0 && gstate.isLightingEnabled();
+
+	u64 hash = XXH3_64bits(&state, sizeof(state));
+	hash = XXH3_64bits_withSeed(control_points, (index_upper_bound + 1) * vertexSize, hash);
+	if (indices) {
+		int indexShift = ((vertType & GE_VTYPE_IDX_MASK) >> GE_VTYPE_IDX_SHIFT) - 1;
+		hash = XXH3_64bits_withSeed(indices, num_points << indexShift, hash);
+	}
+	return hash;
+}
+
 void DrawEngineCommon::ClearSplineBezierWeights() {
 	Bezier3DWeight::weightsCache.Clear();
 	Spline3DWeight::weightsCache.Clear();
@@ -509,56 +606,79 @@ void DrawEngineCommon::SubmitCurve(const void *control_points, const void *indic
 	VertexDecoder *origVDecoder = GetVertexDecoder(vertTypeID);
 	*bytesRead = num_points * origVDecoder->VertexSize();
 
-	// Simplify away bones and morph before proceeding
-	// There are normally not a lot of control points so just splitting decoded should be reasonably safe, although not great.
-	SimpleVertex *simplified_control_points = (SimpleVertex *)managedBuf.Allocate(sizeof(SimpleVertex) * (index_upper_bound + 1));
-	if (!simplified_control_points) {
-		ERROR_LOG(Log::G3D, "Failed to allocate space for simplified control points, skipping curve draw");
-		return;
-	}
-
-	u8 *temp_buffer = managedBuf.Allocate(sizeof(SimpleVertex) * num_points);
-	if (!temp_buffer) {
-		ERROR_LOG(Log::G3D, "Failed to allocate space for temp buffer, skipping curve draw");
-		return;
-	}
-
 	u32 origVertType = vertType;
-	vertType = ::NormalizeVertices(simplified_control_points, temp_buffer, (u8 *)control_points, index_lower_bound, index_upper_bound, origVDecoder, vertType);
-
-	VertexDecoder *vdecoder = GetVertexDecoder(vertType);
-
-	int vertexSize = vdecoder->VertexSize();
-	if (vertexSize != sizeof(SimpleVertex)) {
-		ERROR_LOG(Log::G3D, "Something went really wrong, vertex size: %d vs %d", vertexSize, (int)sizeof(SimpleVertex));
-	}
-
-	// Make an array of pointers to the control points, to get rid of indices.
-	const SimpleVertex **points = (const SimpleVertex **)managedBuf.Allocate(sizeof(SimpleVertex *) * num_points);
-	if (!points) {
-		ERROR_LOG(Log::G3D, "Failed to allocate space for control point pointers, skipping curve draw");
-		return;
-	}
-	for (int idx = 0; idx < num_points; idx++)
-		points[idx] = simplified_control_points + (indices ? ConvertIndex(idx) : idx);
 
 	OutputBuffers output;
 	output.vertices = (SimpleVertex *)(decoded_ + DECODED_VERTEX_BUFFER_SIZE / 2);
 	output.indices = decIndex_;
 	output.count = 0;
 
-	int maxVerts = DECODED_VERTEX_BUFFER_SIZE / 2 / vertexSize;
-
-	surface.Init(maxVerts);
+	// Bones and morph weights aren't part of the key, so those always tessellate.
+	bool useTessCache = !CanUseHardwareTessellation(surface.primType) && (vertType & (GE_VTYPE_WEIGHT_MASK | GE_VTYPE_MORPHCOUNT_MASK)) == 0;
+	u64 tessKey = 0;
+	const TessellationCache::Entry *cached = nullptr;
+	if (useTessCache) {
+		tessCache_->Decimate();
+		tessKey = ComputeTessellationKey(control_points, indices, surface, vertType, origVDecoder->VertexSize(), num_points, index_upper_bound);
+		cached = tessCache_->Lookup(tessKey);
+	}
 
-	if (CanUseHardwareTessellation(surface.primType)) {
-		HardwareTessellation(output, surface, origVertType, points, tessDataTransfer);
+	if (cached) {
+		// Init only adjusts the tessellation factors, which are already baked into the cached output.
+		surface.Init(DECODED_VERTEX_BUFFER_SIZE / 2 / sizeof(SimpleVertex));
+		memcpy(output.vertices, cached->vertices.data(), cached->vertices.size() * sizeof(SimpleVertex));
+		memcpy(output.indices, cached->indices.data(), cached->indices.size() * sizeof(u16));
+		output.count = (int)cached->indices.size();
+		vertType = cached->vertType;
 	} else {
-		ControlPoints cpoints(points, num_points, managedBuf);
-		if (cpoints.IsValid())
-			SoftwareTessellation(output, surface, origVertType, cpoints);
-		else
-			ERROR_LOG(Log::G3D, "Failed to allocate space for control point values, skipping curve draw");
+		// Simplify away bones and morph before proceeding
+		// There are normally not a lot of control points so just splitting decoded should be reasonably safe, although not great.
+		SimpleVertex *simplified_control_points = (SimpleVertex *)managedBuf.Allocate(sizeof(SimpleVertex) * (index_upper_bound + 1));
+		if (!simplified_control_points) {
+			ERROR_LOG(Log::G3D, "Failed to allocate space for simplified control points, skipping curve draw");
+			return;
+		}
+
+		u8 *temp_buffer = managedBuf.Allocate(sizeof(SimpleVertex) * num_points);
+		if (!temp_buffer) {
+			ERROR_LOG(Log::G3D, "Failed to allocate space for temp buffer, skipping curve draw");
+			return;
+		}
+
+		vertType = ::NormalizeVertices(simplified_control_points, temp_buffer, (u8 *)control_points, index_lower_bound, index_upper_bound, origVDecoder, vertType);
+
+		VertexDecoder *vdecoder = GetVertexDecoder(vertType);
+
+		int vertexSize = vdecoder->VertexSize();
+		if (vertexSize != sizeof(SimpleVertex)) {
+			ERROR_LOG(Log::G3D, "Something went really wrong, vertex size: %d vs %d", vertexSize, (int)sizeof(SimpleVertex));
+		}
+
+		// Make an array of pointers to the control points, to get rid of indices.
+		const SimpleVertex **points = (const SimpleVertex **)managedBuf.Allocate(sizeof(SimpleVertex *) * num_points);
+		if (!points) {
+			ERROR_LOG(Log::G3D, "Failed to allocate space for control point pointers, skipping curve draw");
+			return;
+		}
+		for (int idx = 0; idx < num_points; idx++)
+			points[idx] = simplified_control_points + (indices ? ConvertIndex(idx) : idx);
+
+		int maxVerts = DECODED_VERTEX_BUFFER_SIZE / 2 / vertexSize;
+
+		surface.Init(maxVerts);
+
+		if (CanUseHardwareTessellation(surface.primType)) {
+			HardwareTessellation(output, surface, origVertType, points, tessDataTransfer);
+		} else {
+			ControlPoints cpoints(points, num_points, managedBuf);
+			if (cpoints.IsValid()) {
+				SoftwareTessellation(output, surface, origVertType, cpoints);
+				if (useTessCache)
+					tessCache_->Store(tessKey, output, surface.GetVertexCount(), vertType);
+			} else {
+				ERROR_LOG(Log::G3D, "Failed to allocate space for control point values, skipping curve draw");
+			}
+		}
 	}
 
 	u32 vertTypeWithIndex16 = (vertType & ~GE_VTYPE_IDX_MASK) | GE_VTYPE_IDX_16BIT;
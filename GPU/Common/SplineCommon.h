@@ -17,6 +17,7 @@
 
 #pragma once
 #include <unordered_map>
+#include <vector>
 
 #include "Common/CommonTypes.h"
 #include "Common/Swap.h"
@@ -88,6 +89,8 @@ struct BezierSurface : public SurfaceInfo {
 		num_verts_per_patch = (tess_u + 1) * (tess_v + 1);
 	}
 
+	int GetVertexCount() const { return num_verts_per_patch * num_patches_u * num_patches_v; }
+
 	int GetTessStart(int patch) const { return 0; }
 
 	int GetPointIndex(int patch_u, int patch_v) const { return patch_v * 3 * num_points_u + patch_u * 3; }
@@ -126,6 +129,8 @@ struct SplineSurface : public SurfaceInfo {
 		num_vertices_u = num_patches_u * tess_u + 1;
 	}
 
+	int GetVertexCount() const { return num_vertices_u * (num_patches_v * tess_v + 1); }
+
 	int GetTessStart(int patch) const { return (patch == 0) ? 0 : 1; }
 
 	int GetPointIndex(int patch_u, int patch_v) const { return patch_v * num_points_u + patch_u; }
@@ -196,6 +201,30 @@ struct OutputBuffers {
 	int count;
 };
 
+// Software tessellation is expensive, and games tend to draw the same patches every frame.
+// This keeps the output around, keyed by a hash of everything that goes into it.
+class TessellationCache {
+public:
+	struct Entry {
+		std::vector<SimpleVertex> vertices;
+		std::vector<u16> indices;
+		// The normalized vertex type.
+		u32 vertType = 0;
+		int lastFrame = 0;
+		// Only filled on the second miss, so animated patches don't churn through memory.
+		bool filled = false;
+	};
+
+	const Entry *Lookup(u64 key);
+	void Store(u64 key, const OutputBuffers &output, int vertexCount, u32 vertType);
+	void Decimate();
+
+private:
+	std::unordered_map<u64, Entry> entries_;
+	size_t totalBytes_ = 0;
+	int lastDecimateFrame_ = -1;
+};
+
 template<class Surface>
 void SoftwareTessellation(OutputBuffers &output, const Surface &surface, u32 origVertType, const ControlPoints &points);
 
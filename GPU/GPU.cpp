@@ -30,6 +30,7 @@
 #endif
 #include "GPU/Vulkan/GPU_Vulkan.h"
 #include "GPU/Software/SoftGpu.h"
+#include "GPU/Null/GPU_Null.h"
 
 #if PPSSPP_API(D3D9)
 #include "GPU/Directx9/GPU_DX9.h"
@@ -87,6 +88,8 @@ static GPUCommon *CreateGPUCore(GPUCore gpuCore, GraphicsContext *ctx, Draw::Dra
 		}
 		return new GPU_Vulkan(ctx, draw);
 #endif
+	case GPUCORE_NULL:
+		return new GPU_Null(ctx, draw);
 	default:
 		return nullptr;
 	}
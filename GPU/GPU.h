@@ -73,6 +73,7 @@ struct GPUStatistics {
 	void Reset() {
 		ResetFrame();
 		numFlips = 0;
+		msProcessingDisplayListsTotal = 0.0;
 	}
 
 	void ResetFrame() {
@@ -96,6 +97,7 @@ struct GPUStatistics {
 		numFBOsCreated = 0;
 		numBlockingReadbacks = 0;
 		numReadbacks = 0;
+		numReadbacksSkipped = 0;
 		numUploads = 0;
 		numCachedUploads = 0;
 		numDepal = 0;
@@ -109,6 +111,7 @@ struct GPUStatistics {
 		numReplacerTrackedTex = 0;
 		numCachedReplacedTextures = 0;
 		numClutTextures = 0;
+		msProcessingDisplayListsTotal += msProcessingDisplayLists;
 		msProcessingDisplayLists = 0;
 		msPrepareDepth = 0.0;
 		msCullDepth = 0.0;
@@ -124,6 +127,11 @@ struct GPUStatistics {
 		otherGPUCycles = 0;
 	}
 
+	// Only goes up (until a new GPU is created), unlike msProcessingDisplayLists.  Seconds, despite the name.
+	double TotalProcessingDisplayLists() const {
+		return msProcessingDisplayListsTotal + msProcessingDisplayLists;
+	}
+
 	// Per frame statistics
 	int numDrawCalls;
 	int numVertexDecodes;
@@ -145,6 +153,7 @@ struct GPUStatistics {
 	int numFBOsCreated;
 	int numBlockingReadbacks;
 	int numReadbacks;
+	int numReadbacksSkipped;  // Nothing changed in the requested rows.
 	int numUploads;
 	int numCachedUploads;
 	int numDepal;
@@ -159,6 +168,8 @@ struct GPUStatistics {
 	int numCachedReplacedTextures;
 	int numClutTextures;
 	double msProcessingDisplayLists;
+	// Never reset per frame, for measuring across frames.  See TotalProcessingDisplayLists().
+	double msProcessingDisplayListsTotal;
 	double msPrepareDepth;
 	double msCullDepth;
 	double msRasterizeDepth;
@@ -3,6 +3,7 @@
 #include <algorithm>  // std::remove
 
 #include "Common/Profiler/Profiler.h"
+#include "Common/Profiler/TraceRecorder.h"
 
 #include "Common/GraphicsContext.h"
 #include "Common/LogReporting.h"
@@ -746,6 +747,7 @@ DLResult GPUCommon::ProcessDLQueue() {
 	}
 
 	TimeCollector collectStat(&gpuStats.msProcessingDisplayLists, coreCollectDebugStats);
+	TRACE_SCOPE("gpu", "ProcessDLQueue");
 
 	for (int listIndex = GetNextListIndex(); listIndex != -1; listIndex = GetNextListIndex()) {
 		DisplayList &list = dls[listIndex];
@@ -258,6 +258,10 @@ class GPUCommon : public GPUDebugInterface {
 	virtual void ResetMatrices();
 	virtual void DoState(PointerWrap &p);
 	bool BusyDrawing();
+	// Like DrawSync(1), but without side effects.  True while emulated GE work is still in progress.
+	bool DrawPendingAt(u64 ticks) const {
+		return drawCompleteTicks > ticks;
+	}
 	u32 Continue(bool *runList);
 	u32 Break(int mode);
 
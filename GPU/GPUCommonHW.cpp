@@ -1807,7 +1807,7 @@ size_t GPUCommonHW::FormatGPUStatsCommon(char *buffer, size_t size) {
 		"Vertices: %d dec: %d drawn: %d\n"
 		"FBOs active: %d (evaluations: %d, created %d)\n"
 		"Textures: %d, dec: %d, invalidated: %d, hashed: %d kB, clut %d\n"
-		"readbacks %d (%d non-block), upload %d (cached %d), depal %d\n"
+		"readbacks %d (%d non-block, %d skipped), upload %d (cached %d), depal %d\n"
 		"block transfers: %d\n"
 		"replacer: tracks %d references, %d unique textures\n"
 		"Cpy: depth %d, color %d, reint %d, blend %d, self %d\n"
@@ -1837,6 +1837,7 @@ size_t GPUCommonHW::FormatGPUStatsCommon(char *buffer, size_t size) {
 		gpuStats.numClutTextures,
 		gpuStats.numBlockingReadbacks,
 		gpuStats.numReadbacks,
+		gpuStats.numReadbacksSkipped,
 		gpuStats.numUploads,
 		gpuStats.numCachedUploads,
 		gpuStats.numDepal,
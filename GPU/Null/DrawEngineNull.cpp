@@ -0,0 +1,287 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#include <algorithm>
+
+#include "Common/Log.h"
+#include "Common/Profiler/Profiler.h"
+
+#include "GPU/GPUState.h"
+#include "GPU/ge_constants.h"
+
+#include "GPU/Common/GPUStateUtils.h"
+#include "GPU/Common/SoftwareTransformCommon.h"
+#include "GPU/Common/TransformCommon.h"
+#include "GPU/Common/VertexDecoderCommon.h"
+#include "GPU/Null/DrawEngineNull.h"
+#include "GPU/Null/FramebufferManagerNull.h"
+#include "GPU/Null/ShaderManagerNull.h"
+#include "GPU/Null/TextureCacheNull.h"
+
+DrawEngineNull::DrawEngineNull(Draw::DrawContext *draw) : draw_(draw) {
+	decOptions_.expandAllWeightsToFloat = true;
+	decOptions_.expand8BitNormalsToFloat = true;
+	tessDataTransfer = nullptr;
+
+	draw_->SetInvalidationCallback(std::bind(&DrawEngineNull::Invalidate, this, std::placeholders::_1));
+}
+
+DrawEngineNull::~DrawEngineNull() {
+	if (draw_) {
+		draw_->SetInvalidationCallback(InvalidationCallback());
+	}
+}
+
+void DrawEngineNull::Invalidate(InvalidationCallbackFlags flags) {
+	if (flags & InvalidationCallbackFlags::RENDER_PASS_STATE) {
+		gstate_c.Dirty(DIRTY_VIEWPORTSCISSOR_STATE | DIRTY_TEXTURE_IMAGE | DIRTY_TEXTURE_PARAMS);
+	}
+}
+
+// The same decisions as ApplyDrawState in the D3D11 backend, minus building API state objects.
+void DrawEngineNull::ApplyDrawState(int prim) {
+	if (!gstate_c.IsDirty(DIRTY_BLEND_STATE | DIRTY_VIEWPORTSCISSOR_STATE | DIRTY_DEPTHSTENCIL_STATE)) {
+		return;
+	}
+
+	if (gstate_c.IsDirty(DIRTY_BLEND_STATE) && !gstate.isModeClear()) {
+		pipelineState_.Convert(draw_->GetShaderLanguageDesc().bitwiseOps, gstate_c.Use(GPU_USE_SHADER_BLENDING));
+		GenericBlendState &blendState = pipelineState_.blendState;
+
+		if (pipelineState_.FramebufferRead()) {
+			FBOTexState fboTexBindState = FBO_TEX_NONE;
+			ApplyFramebufferRead(&fboTexBindState);
+			ApplyStencilReplaceAndLogicOpIgnoreBlend(blendState.replaceAlphaWithStencil, blendState);
+
+			if (fboTexBindState == FBO_TEX_COPY_BIND_TEX) {
+				framebufferManager_->BindFramebufferAsColorTexture(1, framebufferManager_->GetCurrentRenderVFB(), BINDFBCOLOR_MAY_COPY | BINDFBCOLOR_UNCACHED, 0);
+				fboTexBound_ = true;
+
+				framebufferManager_->RebindFramebuffer("RebindFramebuffer - ApplyDrawState");
+				dirtyRequiresRecheck_ |= DIRTY_BLEND_STATE;
+				gstate_c.Dirty(DIRTY_BLEND_STATE);
+			}
+
+			dirtyRequiresRecheck_ |= DIRTY_FRAGMENTSHADER_STATE;
+			gstate_c.Dirty(DIRTY_FRAGMENTSHADER_STATE);
+		} else if (fboTexBound_) {
+			fboTexBound_ = false;
+			dirtyRequiresRecheck_ |= DIRTY_FRAGMENTSHADER_STATE;
+			gstate_c.Dirty(DIRTY_FRAGMENTSHADER_STATE);
+		}
+
+		if (blendState.blendEnabled && blendState.dirtyShaderBlendFixValues) {
+			dirtyRequiresRecheck_ |= DIRTY_SHADERBLEND;
+			gstate_c.Dirty(DIRTY_SHADERBLEND);
+		}
+	}
+
+	if (gstate_c.IsDirty(DIRTY_DEPTHSTENCIL_STATE) && !gstate.isModeClear()) {
+		GenericStencilFuncState stencilState;
+		ConvertStencilFuncState(stencilState);
+
+		if (!IsDepthTestEffectivelyDisabled()) {
+			UpdateEverUsedEqualDepth(gstate.getDepthTestFunction());
+		}
+		if (stencilState.enabled && SpongebobDepthInverseConditions(stencilState)) {
+			dirtyRequiresRecheck_ |= DIRTY_BLEND_STATE | DIRTY_DEPTHSTENCIL_STATE;
+			gstate_c.Dirty(DIRTY_BLEND_STATE | DIRTY_DEPTHSTENCIL_STATE);
+		}
+	}
+
+	if (gstate_c.IsDirty(DIRTY_VIEWPORTSCISSOR_STATE)) {
+		ViewportAndScissor vpAndScissor;
+		ConvertViewportAndScissor(framebufferManager_->UseBufferedRendering(),
+			framebufferManager_->GetRenderWidth(), framebufferManager_->GetRenderHeight(),
+			framebufferManager_->GetTargetBufferWidth(), framebufferManager_->GetTargetBufferHeight(),
+			vpAndScissor);
+		UpdateCachedViewportState(vpAndScissor);
+
+		viewport_.TopLeftX = vpAndScissor.viewportX;
+		viewport_.TopLeftY = vpAndScissor.viewportY;
+		viewport_.Width = vpAndScissor.viewportW;
+		viewport_.Height = vpAndScissor.viewportH;
+		viewport_.MinDepth = std::max(vpAndScissor.depthRangeMin, 0.0f);
+		viewport_.MaxDepth = std::min(vpAndScissor.depthRangeMax, 1.0f);
+
+		scissor_[0] = vpAndScissor.scissorX;
+		scissor_[1] = vpAndScissor.scissorY;
+		scissor_[2] = std::max(0, vpAndScissor.scissorW);
+		scissor_[3] = std::max(0, vpAndScissor.scissorH);
+	}
+}
+
+void DrawEngineNull::ApplyDrawStateLate() {
+	if (gstate_c.IsDirty(DIRTY_VIEWPORTSCISSOR_STATE)) {
+		draw_->SetViewport(viewport_);
+		draw_->SetScissorRect(scissor_[0], scissor_[1], scissor_[2], scissor_[3]);
+	}
+	gstate_c.Clean(DIRTY_VIEWPORTSCISSOR_STATE | DIRTY_DEPTHSTENCIL_STATE | DIRTY_RASTER_STATE | DIRTY_BLEND_STATE);
+	gstate_c.Dirty(dirtyRequiresRecheck_);
+	dirtyRequiresRecheck_ = 0;
+}
+
+void DrawEngineNull::Flush() {
+	if (!numDrawVerts_) {
+		return;
+	}
+	bool textureNeedsApply = false;
+	if (gstate_c.IsDirty(DIRTY_TEXTURE_IMAGE | DIRTY_TEXTURE_PARAMS) && !gstate.isModeClear() && gstate.isTextureMapEnabled()) {
+		textureCache_->SetTexture();
+		gstate_c.Clean(DIRTY_TEXTURE_IMAGE | DIRTY_TEXTURE_PARAMS);
+		textureNeedsApply = true;
+	} else if (gstate.getTextureAddress(0) == (gstate.getFrameBufRawAddress() | 0x04000000)) {
+		// This catches the case of clearing a texture. (#10957)
+		gstate_c.Dirty(DIRTY_TEXTURE_IMAGE);
+	}
+
+	GEPrimitiveType prim = prevPrim_;
+
+	// Always use software for flat shading to fix the provoking index.
+	bool useHWTransform = CanUseHardwareTransform(prim) && gstate.getShadeMode() != GE_SHADE_FLAT;
+
+	bool hasColor = (lastVType_ & GE_VTYPE_COL_MASK) != GE_VTYPE_COL_NONE;
+	if (useHWTransform) {
+		int vertexCount;
+		int maxIndex;
+		bool useElements;
+		DecodeVerts(dec_, decoded_);
+		DecodeIndsAndGetData(&prim, &vertexCount, &maxIndex, &useElements, false);
+		gpuStats.numUncachedVertsDrawn += vertexCount;
+
+		if (gstate.isModeThrough()) {
+			gstate_c.vertexFullAlpha = gstate_c.vertexFullAlpha && (hasColor || gstate.getMaterialAmbientA() == 255);
+		} else {
+			gstate_c.vertexFullAlpha = gstate_c.vertexFullAlpha && ((hasColor && (gstate.materialupdate & 1)) || gstate.getMaterialAmbientA() == 255) && (!gstate.isLightingEnabled() || gstate.getAmbientA() == 255);
+		}
+
+		if (textureNeedsApply) {
+			textureCache_->ApplyTexture();
+		}
+
+		ApplyDrawState(prim);
+		ApplyDrawStateLate();
+
+		shaderManager_->GetShaders(prim, dec_->VertexType(), pipelineState_, useHWTransform, useHWTessellation_, decOptions_.expandAllWeightsToFloat, applySkinInDecode_);
+		shaderManager_->UpdateUniforms(framebufferManager_->UseBufferedRendering());
+
+		if (useDepthRaster_) {
+			DepthRasterSubmitRaw(prim, dec_, dec_->VertexType(), vertexCount);
+		}
+	} else {
+		PROFILE_THIS_SCOPE("soft");
+		const VertexDecoder *swDec = dec_;
+		if (swDec->nweights != 0) {
+			u32 withSkinning = lastVType_ | (1 << 26);
+			if (withSkinning != lastVType_) {
+				swDec = GetVertexDecoder(withSkinning);
+			}
+		}
+
+		DecodeVerts(swDec, decoded_);
+		int vertexCount = DecodeInds();
+
+		if (gstate.isModeThrough()) {
+			gstate_c.vertexFullAlpha = gstate_c.vertexFullAlpha && (hasColor || gstate.getMaterialAmbientA() == 255);
+		} else {
+			gstate_c.vertexFullAlpha = gstate_c.vertexFullAlpha && ((hasColor && (gstate.materialupdate & 1)) || gstate.getMaterialAmbientA() == 255) && (!gstate.isLightingEnabled() || gstate.getAmbientA() == 255);
+		}
+
+		gpuStats.numUncachedVertsDrawn += vertexCount;
+		prim = IndexGenerator::GeneralPrim((GEPrimitiveType)drawInds_[0].prim);
+
+		u16 *inds = decIndex_;
+		SoftwareTransformResult result{};
+		SoftwareTransformParams params{};
+		params.decoded = decoded_;
+		params.transformed = transformed_;
+		params.transformedExpanded = transformedExpanded_;
+		params.fbman = framebufferManager_;
+		params.texCache = textureCache_;
+		params.allowClear = true;
+		params.allowSeparateAlphaClear = false;
+		params.flippedY = false;
+		params.usesHalfZ = true;
+
+		if (gstate.getShadeMode() == GE_SHADE_FLAT) {
+			// We need to rotate the index buffer to simulate a different provoking vertex.
+			IndexBufferProvokingLastToFirst(prim, inds, vertexCount);
+		}
+
+		// We need correct viewport values in gstate_c already.
+		if (gstate_c.IsDirty(DIRTY_VIEWPORTSCISSOR_STATE)) {
+			ViewportAndScissor vpAndScissor;
+			ConvertViewportAndScissor(framebufferManager_->UseBufferedRendering(),
+				framebufferManager_->GetRenderWidth(), framebufferManager_->GetRenderHeight(),
+				framebufferManager_->GetTargetBufferWidth(), framebufferManager_->GetTargetBufferHeight(),
+				vpAndScissor);
+			UpdateCachedViewportState(vpAndScissor);
+		}
+
+		if (useDepthRaster_) {
+			DepthRasterPredecoded(prim, decoded_, numDecodedVerts_, swDec, vertexCount);
+		}
+
+		SoftwareTransform swTransform(params);
+
+		const Lin::Vec3 trans(gstate_c.vpXOffset, -gstate_c.vpYOffset, gstate_c.vpZOffset * 0.5f + 0.5f);
+		const Lin::Vec3 scale(gstate_c.vpWidthScale, -gstate_c.vpHeightScale, gstate_c.vpDepthScale * 0.5f);
+		swTransform.SetProjMatrix(gstate.projMatrix, gstate_c.vpWidth < 0, gstate_c.vpHeight < 0, trans, scale);
+
+		swTransform.Transform(prim, swDec->VertexType(), swDec->GetDecVtxFmt(), numDecodedVerts_, &result);
+		if (result.action == SW_CLEAR && everUsedEqualDepth_ && gstate.isClearModeDepthMask() && result.depth > 0.0f && result.depth < 1.0f)
+			result.action = SW_NOT_READY;
+
+		if (textureNeedsApply) {
+			gstate_c.pixelMapped = result.pixelMapped;
+			textureCache_->ApplyTexture();
+			gstate_c.pixelMapped = false;
+		}
+
+		ApplyDrawState(prim);
+
+		if (result.action == SW_NOT_READY)
+			swTransform.BuildDrawingParams(prim, vertexCount, swDec->VertexType(), inds, RemainingIndices(inds), numDecodedVerts_, VERTEX_BUFFER_MAX, &result);
+		if (result.setSafeSize)
+			framebufferManager_->SetSafeSize(result.safeWidth, result.safeHeight);
+
+		ApplyDrawStateLate();
+
+		if (result.action == SW_DRAW_INDEXED) {
+			shaderManager_->GetShaders(prim, swDec->VertexType(), pipelineState_, false, false, decOptions_.expandAllWeightsToFloat, true);
+			shaderManager_->UpdateUniforms(framebufferManager_->UseBufferedRendering());
+		} else if (result.action == SW_CLEAR) {
+			Draw::Aspect clearFlag = Draw::Aspect::NO_BIT;
+			if (gstate.isClearModeColorMask()) clearFlag |= Draw::Aspect::COLOR_BIT;
+			if (gstate.isClearModeAlphaMask()) clearFlag |= Draw::Aspect::STENCIL_BIT;
+			if (gstate.isClearModeDepthMask()) clearFlag |= Draw::Aspect::DEPTH_BIT;
+			draw_->Clear(clearFlag, result.color, result.depth, result.color >> 24);
+
+			if (gstate_c.Use(GPU_USE_CLEAR_RAM_HACK) && gstate.isClearModeColorMask() && (gstate.isClearModeAlphaMask() || gstate_c.framebufFormat == GE_FORMAT_565)) {
+				int scissorX1 = gstate.getScissorX1();
+				int scissorY1 = gstate.getScissorY1();
+				int scissorX2 = gstate.getScissorX2() + 1;
+				int scissorY2 = gstate.getScissorY2() + 1;
+				framebufferManager_->ApplyClearToMemory(scissorX1, scissorY1, scissorX2, scissorY2, result.color);
+			}
+		}
+	}
+
+	ResetAfterDrawInline();
+	framebufferManager_->SetColorUpdated(gstate_c.skipDrawReason);
+	gpuCommon_->NotifyFlush();
+}
@@ -0,0 +1,70 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#pragma once
+
+#include "Common/GPU/thin3d.h"
+#include "GPU/Common/VertexDecoderCommon.h"
+#include "GPU/Common/DrawEngineCommon.h"
+
+class ShaderManagerNull;
+class TextureCacheNull;
+class FramebufferManagerNull;
+
+// Does all the decoding, transform and state mapping of the D3D11 backend, but the draws go nowhere.
+class DrawEngineNull : public DrawEngineCommon {
+public:
+	DrawEngineNull(Draw::DrawContext *draw);
+	~DrawEngineNull();
+
+	void DeviceLost() override { draw_ = nullptr; }
+	void DeviceRestore(Draw::DrawContext *draw) override { draw_ = draw; }
+
+	void SetShaderManager(ShaderManagerNull *shaderManager) {
+		shaderManager_ = shaderManager;
+	}
+	void SetTextureCache(TextureCacheNull *textureCache) {
+		textureCache_ = textureCache;
+	}
+	void SetFramebufferManager(FramebufferManagerNull *fbManager) {
+		framebufferManager_ = fbManager;
+	}
+
+	void Flush() override;
+
+	// Nothing is drawn, so there's nothing to upload tessellation data to.
+	bool UpdateUseHWTessellation(bool enable) const override { return false; }
+
+	void FinishDeferred() {
+		DecodeVerts(dec_, decoded_);
+	}
+
+private:
+	void Invalidate(InvalidationCallbackFlags flags);
+
+	void ApplyDrawState(int prim);
+	void ApplyDrawStateLate();
+
+	Draw::DrawContext *draw_;
+
+	ShaderManagerNull *shaderManager_ = nullptr;
+	TextureCacheNull *textureCache_ = nullptr;
+	FramebufferManagerNull *framebufferManager_ = nullptr;
+
+	Draw::Viewport viewport_{};
+	int scissor_[4]{};
+};
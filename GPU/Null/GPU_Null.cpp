@@ -0,0 +1,119 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#include <string>
+
+#include "Common/Log.h"
+#include "Common/GraphicsContext.h"
+
+#include "GPU/GPUState.h"
+
+#include "GPU/Common/FramebufferManagerCommon.h"
+#include "GPU/Null/DrawEngineNull.h"
+#include "GPU/Null/FramebufferManagerNull.h"
+#include "GPU/Null/GPU_Null.h"
+#include "GPU/Null/ShaderManagerNull.h"
+#include "GPU/Null/TextureCacheNull.h"
+
+GPU_Null::GPU_Null(GraphicsContext *gfxCtx, Draw::DrawContext *draw)
+	: GPUCommonHW(gfxCtx, draw), drawEngine_(draw) {
+	shaderManagerNull_ = new ShaderManagerNull(draw);
+	framebufferManagerNull_ = new FramebufferManagerNull(draw);
+	framebufferManager_ = framebufferManagerNull_;
+	textureCacheNull_ = new TextureCacheNull(draw, framebufferManager_->GetDraw2D());
+	textureCache_ = textureCacheNull_;
+	drawEngineCommon_ = &drawEngine_;
+	shaderManager_ = shaderManagerNull_;
+	drawEngine_.SetGPUCommon(this);
+	drawEngine_.SetShaderManager(shaderManagerNull_);
+	drawEngine_.SetTextureCache(textureCacheNull_);
+	drawEngine_.SetFramebufferManager(framebufferManagerNull_);
+	drawEngine_.Init();
+	framebufferManagerNull_->SetTextureCache(textureCacheNull_);
+	framebufferManagerNull_->SetShaderManager(shaderManagerNull_);
+	framebufferManagerNull_->SetDrawEngine(&drawEngine_);
+	framebufferManagerNull_->Init(msaaLevel_);
+	textureCacheNull_->SetFramebufferManager(framebufferManagerNull_);
+	textureCacheNull_->SetShaderManager(shaderManagerNull_);
+
+	UpdateCmdInfo();
+	gstate_c.SetUseFlags(CheckGPUFeatures());
+
+	BuildReportingInfo();
+
+	textureCache_->NotifyConfigChanged();
+}
+
+u32 GPU_Null::CheckGPUFeatures() const {
+	u32 features = GPUCommonHW::CheckGPUFeatures();
+
+	// Match the D3D11 backend, since that's where the draw engine's logic comes from.
+	features |= GPU_USE_ACCURATE_DEPTH;
+	features |= GPU_USE_TEXTURE_FLOAT;
+	features |= GPU_USE_INSTANCE_RENDERING;
+	features |= GPU_USE_TEXTURE_LOD_CONTROL;
+	features |= GPU_USE_16BIT_FORMATS;
+
+	return CheckGPUFeaturesLate(features);
+}
+
+void GPU_Null::DeviceLost() {
+	shaderManager_->ClearShaders();
+	textureCache_->Clear(false);
+
+	GPUCommonHW::DeviceLost();
+}
+
+void GPU_Null::DeviceRestore(Draw::DrawContext *draw) {
+	GPUCommonHW::DeviceRestore(draw);
+}
+
+void GPU_Null::BeginHostFrame() {
+	GPUCommonHW::BeginHostFrame();
+
+	textureCache_->StartFrame();
+	drawEngine_.BeginFrame();
+
+	shaderManager_->DirtyLastShader();
+
+	framebufferManager_->BeginFrame();
+	gstate_c.Dirty(DIRTY_PROJTHROUGHMATRIX);
+
+	if (gstate_c.useFlagsChanged) {
+		shaderManager_->ClearShaders();
+		framebufferManager_->ClearAllDepthBuffers();
+		gstate_c.useFlagsChanged = false;
+	}
+}
+
+void GPU_Null::FinishDeferred() {
+	// This finishes reading any vertex data that is pending.
+	drawEngine_.FinishDeferred();
+}
+
+void GPU_Null::GetStats(char *buffer, size_t bufsize) {
+	size_t offset = FormatGPUStatsCommon(buffer, bufsize);
+	buffer += offset;
+	bufsize -= offset;
+	if ((int)bufsize < 0)
+		return;
+	snprintf(buffer, bufsize,
+		"Vertex, Fragment shaders generated: %d, %d\n",
+		shaderManagerNull_->GetNumVertexShaders(),
+		shaderManagerNull_->GetNumFragmentShaders()
+	);
+}
@@ -0,0 +1,156 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#include <cstring>
+
+#include "Common/GPU/thin3d.h"
+#include "Common/Log.h"
+#include "GPU/GPUState.h"
+#include "GPU/Common/FragmentShaderGenerator.h"
+#include "GPU/Common/GPUStateUtils.h"
+#include "GPU/Common/VertexShaderGenerator.h"
+#include "GPU/Null/ShaderManagerNull.h"
+
+static constexpr size_t CODE_BUFFER_SIZE = 32768;
+
+ShaderManagerNull::ShaderManagerNull(Draw::DrawContext *draw)
+	: ShaderManagerCommon(draw) {
+	codeBuffer_ = new char[CODE_BUFFER_SIZE];
+	memset(&ub_base, 0, sizeof(ub_base));
+	memset(&ub_lights, 0, sizeof(ub_lights));
+	memset(&ub_bones, 0, sizeof(ub_bones));
+}
+
+ShaderManagerNull::~ShaderManagerNull() {
+	ClearShaders();
+	delete[] codeBuffer_;
+}
+
+void ShaderManagerNull::ClearShaders() {
+	vsCache_.clear();
+	fsCache_.clear();
+	DirtyLastShader();
+	gstate_c.Dirty(DIRTY_ALL_UNIFORMS);
+}
+
+void ShaderManagerNull::DirtyLastShader() {
+	lastFSID_.set_invalid();
+	lastVSID_.set_invalid();
+	gstate_c.Dirty(DIRTY_VERTEXSHADER_STATE | DIRTY_FRAGMENTSHADER_STATE);
+}
+
+uint64_t ShaderManagerNull::UpdateUniforms(bool useBufferedRendering) {
+	uint64_t dirty = gstate_c.GetDirtyUniforms();
+	if (dirty != 0) {
+		if (dirty & DIRTY_BASE_UNIFORMS)
+			BaseUpdateUniforms(&ub_base, dirty, true, useBufferedRendering);
+		if (dirty & DIRTY_LIGHT_UNIFORMS)
+			LightUpdateUniforms(&ub_lights, dirty);
+		if (dirty & DIRTY_BONE_UNIFORMS)
+			BoneUpdateUniforms(&ub_bones, dirty);
+	}
+	gstate_c.CleanUniforms();
+	return dirty;
+}
+
+void ShaderManagerNull::GetShaders(int prim, u32 vertexType, const ComputedPipelineState &pipelineState, bool useHWTransform, bool useHWTessellation, bool weightsAsFloat, bool useSkinInDecode) {
+	VShaderID VSID;
+	FShaderID FSID;
+
+	if (gstate_c.IsDirty(DIRTY_VERTEXSHADER_STATE)) {
+		gstate_c.Clean(DIRTY_VERTEXSHADER_STATE);
+		ComputeVertexShaderID(&VSID, vertexType, useHWTransform, useHWTessellation, weightsAsFloat, useSkinInDecode);
+	} else {
+		VSID = lastVSID_;
+	}
+
+	if (gstate_c.IsDirty(DIRTY_FRAGMENTSHADER_STATE)) {
+		gstate_c.Clean(DIRTY_FRAGMENTSHADER_STATE);
+		ComputeFragmentShaderID(&FSID, pipelineState, draw_->GetBugs());
+	} else {
+		FSID = lastFSID_;
+	}
+
+	if (VSID == lastVSID_ && FSID == lastFSID_)
+		return;
+
+	if (vsCache_.find(VSID) == vsCache_.end()) {
+		std::string genErrorString;
+		uint32_t attrMask;
+		uint64_t uniformMask;
+		VertexShaderFlags flags;
+		GenerateVertexShader(VSID, codeBuffer_, draw_->GetShaderLanguageDesc(), draw_->GetBugs(), &attrMask, &uniformMask, &flags, &genErrorString);
+		_assert_msg_(strlen(codeBuffer_) < CODE_BUFFER_SIZE, "VS length error: %d", (int)strlen(codeBuffer_));
+		vsCache_[VSID] = codeBuffer_;
+	}
+	lastVSID_ = VSID;
+
+	if (fsCache_.find(FSID) == fsCache_.end()) {
+		std::string genErrorString;
+		uint64_t uniformMask;
+		FragmentShaderFlags flags;
+		GenerateFragmentShader(FSID, codeBuffer_, draw_->GetShaderLanguageDesc(), draw_->GetBugs(), &uniformMask, &flags, &genErrorString);
+		_assert_msg_(strlen(codeBuffer_) < CODE_BUFFER_SIZE, "FS length error: %d", (int)strlen(codeBuffer_));
+		fsCache_[FSID] = codeBuffer_;
+	}
+	lastFSID_ = FSID;
+}
+
+std::vector<std::string> ShaderManagerNull::DebugGetShaderIDs(DebugShaderType type) {
+	std::string id;
+	std::vector<std::string> ids;
+	switch (type) {
+	case SHADER_TYPE_VERTEX:
+		for (const auto &iter : vsCache_) {
+			iter.first.ToString(&id);
+			ids.push_back(id);
+		}
+		break;
+	case SHADER_TYPE_FRAGMENT:
+		for (const auto &iter : fsCache_) {
+			iter.first.ToString(&id);
+			ids.push_back(id);
+		}
+		break;
+	default:
+		break;
+	}
+	return ids;
+}
+
+std::string ShaderManagerNull::DebugGetShaderString(std::string id, DebugShaderType type, DebugShaderStringType stringType) {
+	ShaderID shaderId;
+	shaderId.FromString(id);
+	switch (type) {
+	case SHADER_TYPE_VERTEX:
+	{
+		auto iter = vsCache_.find(VShaderID(shaderId));
+		if (iter == vsCache_.end())
+			return "";
+		return stringType == SHADER_STRING_SHORT_DESC ? VertexShaderDesc(iter->first) : iter->second;
+	}
+	case SHADER_TYPE_FRAGMENT:
+	{
+		auto iter = fsCache_.find(FShaderID(shaderId));
+		if (iter == fsCache_.end())
+			return "";
+		return stringType == SHADER_STRING_SHORT_DESC ? FragmentShaderDesc(iter->first) : iter->second;
+	}
+	default:
+		return "N/A";
+	}
+}
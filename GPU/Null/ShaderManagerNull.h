@@ -0,0 +1,62 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "Common/CommonTypes.h"
+#include "GPU/Common/ShaderCommon.h"
+#include "GPU/Common/ShaderId.h"
+#include "GPU/Common/ShaderUniforms.h"
+
+struct ComputedPipelineState;
+
+// Generates shader source and uniform data the same way the real backends do, but never compiles or uploads them.
+class ShaderManagerNull : public ShaderManagerCommon {
+public:
+	ShaderManagerNull(Draw::DrawContext *draw);
+	~ShaderManagerNull();
+
+	void GetShaders(int prim, u32 vertexType, const ComputedPipelineState &pipelineState, bool useHWTransform, bool useHWTessellation, bool weightsAsFloat, bool useSkinInDecode);
+	void ClearShaders() override;
+	void DirtyLastShader() override;
+
+	void DeviceLost() override { draw_ = nullptr; }
+	void DeviceRestore(Draw::DrawContext *draw) override { draw_ = draw; }
+	int GetNumVertexShaders() const { return (int)vsCache_.size(); }
+	int GetNumFragmentShaders() const { return (int)fsCache_.size(); }
+
+	std::vector<std::string> DebugGetShaderIDs(DebugShaderType type) override;
+	std::string DebugGetShaderString(std::string id, DebugShaderType type, DebugShaderStringType stringType) override;
+
+	uint64_t UpdateUniforms(bool useBufferedRendering);
+
+private:
+	std::map<VShaderID, std::string> vsCache_;
+	std::map<FShaderID, std::string> fsCache_;
+
+	char *codeBuffer_;
+
+	UB_VS_FS_Base ub_base;
+	UB_VS_Lights ub_lights;
+	UB_VS_Bones ub_bones;
+
+	FShaderID lastFSID_;
+	VShaderID lastVSID_;
+};
@@ -0,0 +1,257 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#include <algorithm>
+#include <cstring>
+
+#include "Common/GPU/thin3d.h"
+#include "Common/Log.h"
+#include "Common/MemoryUtil.h"
+#include "GPU/ge_constants.h"
+#include "GPU/GPUState.h"
+#include "GPU/Common/GPUStateUtils.h"
+#include "GPU/Null/FramebufferManagerNull.h"
+#include "GPU/Null/TextureCacheNull.h"
+
+#include "ext/xxhash.h"
+
+static Draw::DataFormat GetClutDestFormatNull(GEPaletteFormat format) {
+	switch (format) {
+	case GE_CMODE_16BIT_ABGR4444:
+		return Draw::DataFormat::A4R4G4B4_UNORM_PACK16;
+	case GE_CMODE_16BIT_ABGR5551:
+		return Draw::DataFormat::A1R5G5B5_UNORM_PACK16;
+	case GE_CMODE_16BIT_BGR5650:
+		return Draw::DataFormat::R5G6B5_UNORM_PACK16;
+	case GE_CMODE_32BIT_ABGR8888:
+	default:
+		return Draw::DataFormat::R8G8B8A8_UNORM;
+	}
+}
+
+TextureCacheNull::TextureCacheNull(Draw::DrawContext *draw, Draw2D *draw2D)
+	: TextureCacheCommon(draw, draw2D) {
+}
+
+TextureCacheNull::~TextureCacheNull() {
+	Clear(true);
+}
+
+void TextureCacheNull::SetFramebufferManager(FramebufferManagerNull *fbManager) {
+	framebufferManager_ = fbManager;
+}
+
+void TextureCacheNull::ReleaseTexture(TexCacheEntry *entry, bool delete_them) {
+	Draw::Texture *texture = NullTex(entry);
+	if (texture) {
+		texture->Release();
+		entry->texturePtr = nullptr;
+	}
+}
+
+void TextureCacheNull::UpdateCurrentClut(GEPaletteFormat clutFormat, u32 clutBase, bool clutIndexIsSimple) {
+	const u32 clutBaseBytes = clutBase * (clutFormat == GE_CMODE_32BIT_ABGR8888 ? sizeof(u32) : sizeof(u16));
+	// Same as the other backends, see TextureCacheD3D11::UpdateCurrentClut.
+	const u32 clutExtendedBytes = std::min(clutTotalBytes_ + clutBaseBytes, clutMaxBytes_);
+
+	if (replacer_.Enabled())
+		clutHash_ = XXH32((const char *)clutBufRaw_, clutExtendedBytes, 0xC0108888);
+	else
+		clutHash_ = XXH3_64bits((const char *)clutBufRaw_, clutExtendedBytes) & 0xFFFFFFFF;
+	clutBuf_ = clutBufRaw_;
+
+	// Special optimization: fonts typically draw clut4 with just alpha values in a single color.
+	clutAlphaLinear_ = false;
+	clutAlphaLinearColor_ = 0;
+	if (clutFormat == GE_CMODE_16BIT_ABGR4444 && clutIndexIsSimple) {
+		const u16_le *clut = GetCurrentClut<u16_le>();
+		clutAlphaLinear_ = true;
+		clutAlphaLinearColor_ = clut[15] & 0x0FFF;
+		for (int i = 0; i < 16; ++i) {
+			u16 step = clutAlphaLinearColor_ | (i << 12);
+			if (clut[i] != step) {
+				clutAlphaLinear_ = false;
+				break;
+			}
+		}
+	}
+
+	clutLastFormat_ = gstate.clutformat;
+}
+
+void TextureCacheNull::BindTexture(TexCacheEntry *entry) {
+	if (!entry) {
+		draw_->BindTexture(0, nullptr);
+		return;
+	}
+	draw_->BindTexture(0, NullTex(entry));
+	int maxLevel = (entry->status & TexCacheEntry::STATUS_NO_MIPS) ? 0 : entry->maxLevel;
+	// Computed for the same cost as the real backends, even though there's nothing to apply it to.
+	SamplerCacheKey samplerKey = GetSamplingParams(maxLevel, entry);
+	ApplySamplingParams(samplerKey);
+	gstate_c.SetUseShaderDepal(ShaderDepalMode::OFF);
+}
+
+void TextureCacheNull::Unbind() {
+	draw_->BindTexture(0, nullptr);
+}
+
+void TextureCacheNull::BuildTexture(TexCacheEntry *const entry) {
+	BuildTexturePlan plan;
+	if (!PrepareBuildTexture(plan, entry)) {
+		return;
+	}
+
+	Draw::DataFormat dstFmt = GetDestFormat(GETextureFormat(entry->format), gstate.getClutPaletteFormat());
+	if (plan.doReplace) {
+		dstFmt = plan.replaced->Format();
+	} else if (plan.scaleFactor > 1 || plan.saveTexture) {
+		dstFmt = Draw::DataFormat::R8G8B8A8_UNORM;
+	} else if (plan.decodeToClut8) {
+		dstFmt = Draw::DataFormat::R8_UNORM;
+	}
+
+	_assert_(NullTex(entry) == nullptr);
+
+	int levels;
+	if (plan.depth == 1) {
+		// No mip generation, so clamp the number of levels to the ones we can load directly.
+		levels = std::min(plan.levelsToCreate, plan.levelsToLoad);
+	} else {
+		levels = plan.depth;
+	}
+
+	int tw;
+	int th;
+	plan.GetMipSize(0, &tw, &th);
+
+	Draw::TextureDesc desc{};
+	desc.type = plan.depth == 1 ? Draw::TextureType::LINEAR2D : Draw::TextureType::LINEAR3D;
+	desc.format = dstFmt;
+	desc.width = tw;
+	desc.height = th;
+	desc.depth = plan.depth;
+	desc.mipLevels = plan.depth == 1 ? levels : 1;
+	desc.tag = "game";
+
+	// The PSP only supports 8 mip levels, but we support more in the texture replacer.
+	u8 *levelData[20]{};
+	for (int i = 0; i < levels; i++) {
+		int srcLevel = (i == 0) ? plan.baseLevelSrc : i;
+
+		int mipWidth;
+		int mipHeight;
+		plan.GetMipSize(i, &mipWidth, &mipHeight);
+
+		int stride;
+		int dataSize;
+		if (plan.doReplace) {
+			int blockSize = 0;
+			if (Draw::DataFormatIsBlockCompressed(plan.replaced->Format(), &blockSize)) {
+				stride = ((mipWidth + 3) & ~3) * blockSize / 4;
+				dataSize = plan.replaced->GetLevelDataSizeAfterCopy(i);
+			} else {
+				stride = mipWidth * (int)Draw::DataFormatSizeInBytes(plan.replaced->Format());
+				dataSize = stride * mipHeight;
+			}
+		} else {
+			int bpp = plan.scaleFactor > 1 ? 4 : (int)Draw::DataFormatSizeInBytes(dstFmt);
+			stride = mipWidth * bpp;
+			dataSize = stride * mipHeight;
+		}
+
+		u8 *data;
+		if (plan.depth == 1) {
+			data = (u8 *)AllocateAlignedMemory(dataSize, 16);
+			levelData[i] = data;
+		} else {
+			if (i == 0)
+				levelData[0] = (u8 *)AllocateAlignedMemory(dataSize * plan.depth, 16);
+			data = levelData[0] ? levelData[0] + dataSize * i : nullptr;
+		}
+
+		if (!data) {
+			ERROR_LOG(Log::G3D, "Ran out of RAM trying to allocate a temporary texture upload buffer (%dx%d)", mipWidth, mipHeight);
+			break;
+		}
+
+		LoadTextureLevel(*entry, data, dataSize, stride, plan, srcLevel, dstFmt, TexDecodeFlags{});
+	}
+
+	int numLevels = plan.depth == 1 ? levels : 1;
+	for (int i = 0; i < numLevels; i++) {
+		if (levelData[i])
+			desc.initData.push_back(levelData[i]);
+	}
+	if ((int)desc.initData.size() == numLevels)
+		entry->texturePtr = draw_->CreateTexture(desc);
+
+	for (int i = 0; i < numLevels; i++) {
+		if (levelData[i])
+			FreeAlignedMemory(levelData[i]);
+	}
+
+	if (plan.depth > 1) {
+		entry->status |= TexCacheEntry::STATUS_3D;
+	}
+
+	if (levels == 1 || plan.depth > 1) {
+		entry->status |= TexCacheEntry::STATUS_NO_MIPS;
+	} else {
+		entry->status &= ~TexCacheEntry::STATUS_NO_MIPS;
+	}
+
+	if (plan.doReplace) {
+		entry->SetAlphaStatus(TexCacheEntry::TexStatus(plan.replaced->AlphaStatus()));
+
+		if (!Draw::DataFormatIsBlockCompressed(plan.replaced->Format(), nullptr)) {
+			entry->status |= TexCacheEntry::STATUS_BGRA;
+		}
+	} else {
+		entry->status |= TexCacheEntry::STATUS_BGRA;
+	}
+}
+
+Draw::DataFormat TextureCacheNull::GetDestFormat(GETextureFormat format, GEPaletteFormat clutFormat) const {
+	if (!gstate_c.Use(GPU_USE_16BIT_FORMATS)) {
+		return Draw::DataFormat::R8G8B8A8_UNORM;
+	}
+
+	switch (format) {
+	case GE_TFMT_CLUT4:
+	case GE_TFMT_CLUT8:
+	case GE_TFMT_CLUT16:
+	case GE_TFMT_CLUT32:
+		return GetClutDestFormatNull(clutFormat);
+	case GE_TFMT_4444:
+		return Draw::DataFormat::A4R4G4B4_UNORM_PACK16;
+	case GE_TFMT_5551:
+		return Draw::DataFormat::A1R5G5B5_UNORM_PACK16;
+	case GE_TFMT_5650:
+		return Draw::DataFormat::R5G6B5_UNORM_PACK16;
+	case GE_TFMT_8888:
+	case GE_TFMT_DXT1:
+	case GE_TFMT_DXT3:
+	case GE_TFMT_DXT5:
+	default:
+		return Draw::DataFormat::R8G8B8A8_UNORM;
+	}
+}
+
+void *TextureCacheNull::GetNativeTextureView(const TexCacheEntry *entry, bool flat) const {
+	return entry->texturePtr;
+}
@@ -0,0 +1,55 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#pragma once
+
+#include "GPU/GPU.h"
+#include "GPU/GPUCommon.h"
+#include "GPU/Common/TextureCacheCommon.h"
+
+class FramebufferManagerNull;
+
+// Decodes textures exactly like the D3D11 backend, then hands them to the DrawContext, which just keeps them in memory.
+class TextureCacheNull : public TextureCacheCommon {
+public:
+	TextureCacheNull(Draw::DrawContext *draw, Draw2D *draw2D);
+	~TextureCacheNull();
+
+	void SetFramebufferManager(FramebufferManagerNull *fbManager);
+
+	void ForgetLastTexture() override {}
+
+	void DeviceLost() override { draw_ = nullptr; }
+	void DeviceRestore(Draw::DrawContext *draw) override { draw_ = draw; }
+
+protected:
+	void BindTexture(TexCacheEntry *entry) override;
+	void Unbind() override;
+	void ReleaseTexture(TexCacheEntry *entry, bool delete_them) override;
+	void ApplySamplingParams(const SamplerCacheKey &key) override {}
+	void *GetNativeTextureView(const TexCacheEntry *entry, bool flat) const override;
+
+private:
+	Draw::DataFormat GetDestFormat(GETextureFormat format, GEPaletteFormat clutFormat) const;
+	void UpdateCurrentClut(GEPaletteFormat clutFormat, u32 clutBase, bool clutIndexIsSimple) override;
+
+	void BuildTexture(TexCacheEntry *const entry) override;
+
+	Draw::Texture *NullTex(const TexCacheEntry *entry) const {
+		return (Draw::Texture *)entry->texturePtr;
+	}
+};
@@ -63,7 +63,26 @@ struct BinWaitable : public Waitable {
 		}
 	}
 
+	// Tasks call this as they move to the next item.  Cheap unless someone's in WaitUntil().
+	void Progress() {
+		if (partialWait_) {
+			std::unique_lock<std::mutex> lock(mutex_);
+			cond_.notify_all();
+		}
+	}
+
+	template <typename F>
+	void WaitUntil(F done) {
+		std::unique_lock<std::mutex> lock(mutex_);
+		partialWait_ = true;
+		while (count_ != 0 && !done()) {
+			cond_.wait(lock);
+		}
+		partialWait_ = false;
+	}
+
 	std::atomic<int> count_;
+	std::atomic<bool> partialWait_{};
 	std::mutex mutex_;
 	std::condition_variable cond_;
 };
@@ -98,8 +117,8 @@ static inline void DrawBinItem(const BinItem &item, const RasterizerState &state
 
 class DrawBinItemsTask : public Task {
 public:
-	DrawBinItemsTask(BinWaitable *notify, BinManager::BinItemQueue &items, std::atomic<bool> &status, const BinManager::BinStateQueue &states)
-		: notify_(notify), items_(items), status_(status), states_(states) {
+	DrawBinItemsTask(BinWaitable *notify, BinManager::BinItemQueue &items, std::atomic<bool> &status, std::atomic<uint32_t> &seq, const BinManager::BinStateQueue &states)
+		: notify_(notify), items_(items), status_(status), seq_(seq), states_(states) {
 	}
 
 	TaskType Type() const override {
@@ -127,14 +146,18 @@ class DrawBinItemsTask : public Task {
 	void ProcessItems() {
 		while (!items_.Empty()) {
 			const BinItem &item = items_.PeekNext();
+			seq_ = item.seq;
+			notify_->Progress();
 			DrawBinItem(item, states_[item.stateIndex]);
 			items_.SkipNext();
 		}
+		notify_->Progress();
 	}
 
 	BinWaitable *notify_;
 	BinManager::BinItemQueue &items_;
 	std::atomic<bool> &status_;
+	std::atomic<uint32_t> &seq_;
 	const BinManager::BinStateQueue &states_;
 };
 
@@ -149,12 +172,14 @@ BinManager::BinManager() {
 	waitable_ = new BinWaitable();
 	for (auto &s : taskStatus_)
 		s = false;
+	for (auto &s : taskSeq_)
+		s = 0;
 
 	int maxInitTasks = std::min(g_threadManager.GetNumLooperThreads(), MAX_POSSIBLE_TASKS);
 	for (int i = 0; i < maxInitTasks; ++i) {
 		taskQueues_[i].Setup();
 		for (DrawBinItemsTask *&task : taskLists_[i].tasks)
-			task = new DrawBinItemsTask(waitable_, taskQueues_[i], taskStatus_[i], states_);
+			task = new DrawBinItemsTask(waitable_, taskQueues_[i], taskStatus_[i], taskSeq_[i], states_);
 	}
 	states_.Setup();
 	cluts_.Setup();
@@ -204,17 +229,17 @@ void BinManager::UpdateState() {
 		scissor_.x2 = screenScissorBR.x + SCREEN_SCALE_FACTOR - 1;
 		scissor_.y2 = screenScissorBR.y + SCREEN_SCALE_FACTOR - 1;
 
-		// If we're about to texture from something still pending (i.e. depth), flush.
-		if (HasTextureWrite(state))
-			Flush("tex");
+		// If we're about to texture from something still pending (i.e. depth), wait for it.
+		FlushPending("tex", TextureWriteSeq(state));
 
 		// Okay, now update what's pending.
 		MarkPendingWrites(state);
 
 		ClearDirty(SoftDirty::BINNER_RANGE);
 	} else if (pendingOverlap_) {
-		if (HasTextureWrite(state)) {
-			Flush("tex");
+		uint32_t texSeq = TextureWriteSeq(state);
+		if (texSeq != 0) {
+			FlushPending("tex", texSeq);
 
 			// We need the pending writes set, which flushing cleared.  Set them again.
 			MarkPendingWrites(state);
@@ -250,20 +275,20 @@ void BinManager::UpdateState() {
 	}
 }
 
-bool BinManager::HasTextureWrite(const RasterizerState &state) {
+uint32_t BinManager::TextureWriteSeq(const RasterizerState &state) {
 	if (!state.enableTextures)
-		return false;
+		return 0;
 
+	uint32_t seq = 0;
 	const uint8_t textureBits = textureBitsPerPixel[state.samplerID.texfmt];
 	for (int i = 0; i <= state.maxTexLevel; ++i) {
 		int byteStride = (state.texbufw[i] * textureBits) / 8;
 		int byteWidth = (state.samplerID.cached.sizes[i].w * textureBits) / 8;
 		int h = state.samplerID.cached.sizes[i].h;
-		if (HasPendingWrite(state.texaddr[i], byteStride, byteWidth, h))
-			return true;
+		seq = std::max(seq, PendingWriteSeq(state.texaddr[i], byteStride, byteWidth, h));
 	}
 
-	return false;
+	return seq;
 }
 
 bool BinManager::IsExactSelfRender(const Rasterizer::RasterizerState &state, const BinItem &item) {
@@ -301,6 +326,14 @@ bool BinManager::IsExactSelfRender(const Rasterizer::RasterizerState &state, con
 }
 
 void BinManager::MarkPendingReads(const Rasterizer::RasterizerState &state) {
+	// Textures from previous states are only read by items queued so far.
+	for (uint32_t addr : activeReads_) {
+		auto it = pendingReads_.find(addr);
+		if (it != pendingReads_.end())
+			it->second.endSeq = queuedSeq_;
+	}
+	activeReads_.clear();
+
 	if (!state.enableTextures)
 		return;
 
@@ -318,13 +351,16 @@ void BinManager::MarkPendingReads(const Rasterizer::RasterizerState &state) {
 				it->second.widthBytes = std::max(it->second.widthBytes, byteWidth);
 				it->second.height = std::max(it->second.height, h);
 			}
+			it->second.endSeq = SEQ_ACTIVE;
 		} else {
 			auto &range = pendingReads_[state.texaddr[i]];
 			range.base = state.texaddr[i];
 			range.strideBytes = byteStride;
 			range.widthBytes = byteWidth;
 			range.height = h;
+			range.endSeq = SEQ_ACTIVE;
 		}
+		activeReads_.push_back(state.texaddr[i]);
 	}
 }
 
@@ -335,8 +371,14 @@ void BinManager::MarkPendingWrites(const Rasterizer::RasterizerState &state) {
 	constexpr uint32_t mirrorMask = 0x041FFFFF;
 	const uint32_t bpp = state.pixelID.FBFormat() == GE_FORMAT_8888 ? 4 : 2;
 	pendingWrites_[0].Expand(gstate.getFrameBufAddress() & mirrorMask, bpp, gstate.FrameBufStride(), scissorTL, scissorBR);
-	if (state.pixelID.depthWrite)
+	pendingWrites_[0].endSeq = SEQ_ACTIVE;
+	if (state.pixelID.depthWrite) {
 		pendingWrites_[1].Expand(gstate.getDepthBufAddress() & mirrorMask, 2, gstate.DepthBufStride(), scissorTL, scissorBR);
+		pendingWrites_[1].endSeq = SEQ_ACTIVE;
+	} else if (pendingWrites_[1].endSeq == SEQ_ACTIVE) {
+		// Only items queued so far write depth, so reads can wait for just those.
+		pendingWrites_[1].endSeq = queuedSeq_;
+	}
 }
 
 inline void BinDirtyRange::Expand(uint32_t newBase, uint32_t bpp, uint32_t stride, const DrawingCoords &tl, const DrawingCoords &br) {
@@ -394,7 +436,7 @@ void BinManager::AddTriangle(const VertexData &v0, const VertexData &v1, const V
 
 	if (queue_.Full())
 		Drain();
-	queue_.Push(BinItem{ BinItemType::TRIANGLE, stateIndex_, range, v0, v1, v2 });
+	queue_.Push(BinItem{ BinItemType::TRIANGLE, stateIndex_, queuedSeq_++, range, v0, v1, v2 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0, v1, v2);
 	Expand(range);
 }
@@ -406,7 +448,7 @@ void BinManager::AddClearRect(const VertexData &v0, const VertexData &v1) {
 
 	if (queue_.Full())
 		Drain();
-	queue_.Push(BinItem{ BinItemType::CLEAR_RECT, stateIndex_, range, v0, v1 });
+	queue_.Push(BinItem{ BinItemType::CLEAR_RECT, stateIndex_, queuedSeq_++, range, v0, v1 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0, v1, true);
 	Expand(range);
 }
@@ -418,7 +460,7 @@ void BinManager::AddRect(const VertexData &v0, const VertexData &v1) {
 
 	if (queue_.Full())
 		Drain();
-	queue_.Push(BinItem{ BinItemType::RECT, stateIndex_, range, v0, v1 });
+	queue_.Push(BinItem{ BinItemType::RECT, stateIndex_, queuedSeq_++, range, v0, v1 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0, v1, true);
 	Expand(range);
 }
@@ -430,7 +472,7 @@ void BinManager::AddSprite(const VertexData &v0, const VertexData &v1) {
 
 	if (queue_.Full())
 		Drain();
-	queue_.Push(BinItem{ BinItemType::SPRITE, stateIndex_, range, v0, v1 });
+	queue_.Push(BinItem{ BinItemType::SPRITE, stateIndex_, queuedSeq_++, range, v0, v1 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0, v1, true);
 	Expand(range);
 }
@@ -442,7 +484,7 @@ void BinManager::AddLine(const VertexData &v0, const VertexData &v1) {
 
 	if (queue_.Full())
 		Drain();
-	queue_.Push(BinItem{ BinItemType::LINE, stateIndex_, range, v0, v1 });
+	queue_.Push(BinItem{ BinItemType::LINE, stateIndex_, queuedSeq_++, range, v0, v1 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0, v1, false);
 	Expand(range);
 }
@@ -454,7 +496,7 @@ void BinManager::AddPoint(const VertexData &v0) {
 
 	if (queue_.Full())
 		Drain();
-	queue_.Push(BinItem{ BinItemType::POINT, stateIndex_, range, v0 });
+	queue_.Push(BinItem{ BinItemType::POINT, stateIndex_, queuedSeq_++, range, v0 });
 	CalculateRasterStateFlags(&states_[stateIndex_], v0);
 	Expand(range);
 }
@@ -587,6 +629,12 @@ void BinManager::Flush(const char *reason) {
 		pending.base = 0;
 	pendingOverlap_ = false;
 	pendingReads_.clear();
+	activeReads_.clear();
+
+	// Everything's drawn, so we can start counting again.
+	queuedSeq_ = 0;
+	for (auto &s : taskSeq_)
+		s = 0;
 
 	// We'll need to set the pending writes and reads again, since we just flushed it.
 	dirty_ |= SoftDirty::BINNER_RANGE | SoftDirty::BINNER_OVERLAP;
@@ -601,6 +649,63 @@ void BinManager::Flush(const char *reason) {
 	}
 }
 
+bool BinManager::FlushPending(const char *reason, uint32_t seq) {
+	if (seq == 0)
+		return false;
+	// If it needs everything, a regular flush also lets us reset the queues.
+	if (seq >= queuedSeq_) {
+		Flush(reason);
+		return true;
+	}
+
+	double st;
+	if (coreCollectDebugStats)
+		st = time_now_d();
+
+	// Items from seq onward may still be drawing after this, but that's fine: they don't touch the range.
+	while (!PendingDone(seq)) {
+		Drain(true);
+		waitable_->WaitUntil([&] { return PendingDone(seq); });
+	}
+	RetirePending(seq);
+
+	if (coreCollectDebugStats) {
+		double et = time_now_d();
+		flushReasonTimes_[reason] += et - st;
+		if (et - st > slowestFlushTime_) {
+			slowestFlushTime_ = et - st;
+			slowestFlushReason_ = reason;
+		}
+	}
+	return false;
+}
+
+bool BinManager::PendingDone(uint32_t seq) {
+	// Anything still in the main queue hasn't been drawn yet.
+	if (!queue_.Empty() && queue_.PeekNext().seq < seq)
+		return false;
+
+	for (int i = 0; i < (int)taskRanges_.size(); ++i) {
+		// The task sets its seq before drawing an item, so all earlier items in its queue are done.
+		if (!taskQueues_[i].Empty() && taskSeq_[i] < seq)
+			return false;
+	}
+	return true;
+}
+
+void BinManager::RetirePending(uint32_t seq) {
+	for (auto &pending : pendingWrites_) {
+		if (pending.base != 0 && pending.endSeq <= seq)
+			pending.base = 0;
+	}
+	for (auto it = pendingReads_.begin(); it != pendingReads_.end(); ) {
+		if (it->second.endSeq <= seq)
+			it = pendingReads_.erase(it);
+		else
+			++it;
+	}
+}
+
 void BinManager::OptimizePendingStates(uint16_t first, uint16_t last) {
 	// We can sometimes hit this when compiling new funcs while creating a state.
 	// At that point, the state isn't loaded fully yet, so don't touch it.
@@ -617,13 +722,14 @@ void BinManager::OptimizePendingStates(uint16_t first, uint16_t last) {
 	}
 }
 
-bool BinManager::HasPendingWrite(uint32_t start, uint32_t stride, uint32_t w, uint32_t h) {
+uint32_t BinManager::PendingWriteSeq(uint32_t start, uint32_t stride, uint32_t w, uint32_t h) {
 	// We can only write to VRAM.
 	if (!Memory::IsVRAMAddress(start))
-		return false;
+		return 0;
 	// Ignore mirrors for overlap detection.
 	start &= 0x041FFFFF;
 
+	uint32_t seq = 0;
 	uint32_t size = stride * (h - 1) + w;
 	for (const auto &range : pendingWrites_) {
 		if (range.base == 0 || range.strideBytes == 0)
@@ -639,18 +745,20 @@ bool BinManager::HasPendingWrite(uint32_t start, uint32_t stride, uint32_t w, ui
 			uint32_t rangeX = offset % (int32_t)range.strideBytes;
 			if (rangeY >= 0 && (uint32_t)rangeY < range.height) {
 				// If this row is either within width, or extends beyond stride, overlap.
-				if (rangeX < range.widthBytes || rangeX + w >= range.strideBytes)
-					return true;
+				if (rangeX < range.widthBytes || rangeX + w >= range.strideBytes) {
+					seq = std::max(seq, range.endSeq);
+					break;
+				}
 			}
 
 			row += stride;
 		}
 	}
 
-	return false;
+	return seq;
 }
 
-bool BinManager::HasPendingRead(uint32_t start, uint32_t stride, uint32_t w, uint32_t h) {
+uint32_t BinManager::PendingReadSeq(uint32_t start, uint32_t stride, uint32_t w, uint32_t h) {
 	if (Memory::IsVRAMAddress(start)) {
 		// Ignore VRAM mirrors.
 		start &= 0x041FFFFF;
@@ -659,6 +767,7 @@ bool BinManager::HasPendingRead(uint32_t start, uint32_t stride, uint32_t w, uin
 		start &= 0x3FFFFFFF;
 	}
 
+	uint32_t seq = 0;
 	uint32_t size = stride * (h - 1) + w;
 	for (const auto &pair : pendingReads_) {
 		const auto &range = pair.second;
@@ -666,10 +775,10 @@ bool BinManager::HasPendingRead(uint32_t start, uint32_t stride, uint32_t w, uin
 			continue;
 
 		// Stride gaps are uncommon with reads, so don't bother.
-		return true;
+		seq = std::max(seq, range.endSeq);
 	}
 
-	return false;
+	return seq;
 }
 
 void BinManager::GetStats(char *buffer, size_t bufsize) {
@@ -49,6 +49,8 @@ struct BinCoords {
 struct BinItem {
 	BinItemType type;
 	uint16_t stateIndex;
+	// Order items were added in since the last flush, used to wait for only part of the queue.
+	uint32_t seq;
 	BinCoords range;
 	VertexData v0;
 	VertexData v1;
@@ -178,6 +180,8 @@ struct BinDirtyRange {
 	uint32_t strideBytes;
 	uint32_t widthBytes;
 	uint32_t height;
+	// Items before this seq may still access the range, or SEQ_ACTIVE if the current state does.
+	uint32_t endSeq;
 
 	void Expand(uint32_t newBase, uint32_t bpp, uint32_t stride, const DrawingCoords &tl, const DrawingCoords &br);
 };
@@ -201,11 +205,16 @@ class BinManager {
 	void AddLine(const VertexData &v0, const VertexData &v1);
 	void AddPoint(const VertexData &v0);
 
+	static constexpr uint32_t SEQ_ACTIVE = 0xFFFFFFFF;
+
 	void Drain(bool flushing = false);
 	void Flush(const char *reason);
-	bool HasPendingWrite(uint32_t start, uint32_t stride, uint32_t w, uint32_t h);
+	// Waits only for items before seq to finish drawing, later ones keep going.  Returns true if it had to flush everything.
+	bool FlushPending(const char *reason, uint32_t seq);
+	// These return the seq to pass to FlushPending() to resolve the overlap, or 0 if nothing overlaps.
+	uint32_t PendingWriteSeq(uint32_t start, uint32_t stride, uint32_t w, uint32_t h);
 	// Assumes you've also checked for a write (writes are partial so are automatically reads.)
-	bool HasPendingRead(uint32_t start, uint32_t stride, uint32_t w, uint32_t h);
+	uint32_t PendingReadSeq(uint32_t start, uint32_t stride, uint32_t w, uint32_t h);
 
 	void GetStats(char *buffer, size_t bufsize);
 	void ResetStats();
@@ -257,10 +266,14 @@ class BinManager {
 	BinItemQueue taskQueues_[MAX_POSSIBLE_TASKS];
 	BinTaskList taskLists_[MAX_POSSIBLE_TASKS];
 	std::atomic<bool> taskStatus_[MAX_POSSIBLE_TASKS];
+	// Seq of the item each task is drawing, so everything before it in that task is done.
+	std::atomic<uint32_t> taskSeq_[MAX_POSSIBLE_TASKS];
 	BinWaitable *waitable_ = nullptr;
+	uint32_t queuedSeq_ = 0;
 
 	BinDirtyRange pendingWrites_[2]{};
 	std::unordered_map<uint32_t, BinDirtyRange> pendingReads_;
+	std::vector<uint32_t> activeReads_;
 
 	bool pendingOverlap_ = false;
 	bool creatingState_ = false;
@@ -276,7 +289,12 @@ class BinManager {
 
 	void MarkPendingReads(const Rasterizer::RasterizerState &state);
 	void MarkPendingWrites(const Rasterizer::RasterizerState &state);
-	bool HasTextureWrite(const Rasterizer::RasterizerState &state);
+	bool HasTextureWrite(const Rasterizer::RasterizerState &state) {
+		return TextureWriteSeq(state) != 0;
+	}
+	uint32_t TextureWriteSeq(const Rasterizer::RasterizerState &state);
+	void RetirePending(uint32_t seq);
+	bool PendingDone(uint32_t seq);
 	static bool IsExactSelfRender(const Rasterizer::RasterizerState &state, const BinItem &item);
 	void OptimizePendingStates(uint16_t first, uint16_t last);
 	BinCoords Scissor(BinCoords range);
@@ -781,17 +781,33 @@ static inline Vec4<int> SOFTRAST_CALL CheckDepthTestPassed4(const Vec4<int> &mas
 	return result;
 }
 
+// Triangles are walked in blocks of 4x4 quads (8x8 pixels.)  Each block is classified first
+// using its corner pixels, so blocks outside an edge are skipped and the edge tests are skipped
+// for blocks fully inside.  Since the edge functions are linear, the corners bound the block.
+static constexpr int BLOCK_QUADS = 4;
+static constexpr int BLOCK_SCREEN_SIZE = BLOCK_QUADS * 2 * SCREEN_SCALE_FACTOR;
+// Enough for the widest possible scissor, blocks past this are just treated as partial.
+static constexpr int MAX_BLOCKS_X = 1024 / (BLOCK_QUADS * 2) + 1;
+
+enum class BlockCoverage : uint8_t {
+	OUTSIDE,
+	PARTIAL,
+	INSIDE,
+};
+
 template <bool useSSE4>
 struct TriangleEdge {
 	Vec4<int> Start(const ScreenCoords &v0, const ScreenCoords &v1, const ScreenCoords &origin);
 	inline Vec4<int> StepX(const Vec4<int> &w);
 	inline Vec4<int> StepY(const Vec4<int> &w);
-
-	inline void NarrowMinMaxX(const Vec4<int> &w, int64_t minX, int64_t &rowMinX, int64_t &rowMaxX);
-	inline Vec4<int> StepXTimes(const Vec4<int> &w, int c);
+	inline Vec4<int> StepBlockX(const Vec4<int> &w);
+	// Takes the quad weights at the block's origin, returns the weights at the block's corner pixels.
+	inline Vec4<int> BlockCorners(const Vec4<int> &w);
 
 	Vec4<int> stepX;
 	Vec4<int> stepY;
+	Vec4<int> blockStepX;
+	Vec4<int> cornerOffsets;
 };
 
 #if defined(_M_SSE) && !PPSSPP_ARCH(X86)
@@ -820,6 +836,10 @@ Vec4<int> TriangleEdge<useSSE4>::Start(const ScreenCoords &v0, const ScreenCoord
 
 	stepX = Vec4<int>::AssignToAll(xf * SCREEN_SCALE_FACTOR * 2);
 	stepY = Vec4<int>::AssignToAll(yf * SCREEN_SCALE_FACTOR * 2);
+	blockStepX = Vec4<int>::AssignToAll(xf * BLOCK_SCREEN_SIZE);
+
+	static constexpr int lastPixelOff = BLOCK_SCREEN_SIZE - SCREEN_SCALE_FACTOR;
+	cornerOffsets = Vec4<int>(0, xf * lastPixelOff, yf * lastPixelOff, (xf + yf) * lastPixelOff);
 
 #if defined(_M_SSE) && !PPSSPP_ARCH(X86)
 	if constexpr (useSSE4)
@@ -850,65 +870,26 @@ inline Vec4<int> TriangleEdge<useSSE4>::StepY(const Vec4<int> &w) {
 #endif
 }
 
-#if defined(_M_SSE) && !PPSSPP_ARCH(X86)
-#if defined(__GNUC__) || defined(__clang__) || defined(__INTEL_COMPILER)
-[[gnu::target("sse4.1")]]
-#endif
-static inline int SOFTRAST_CALL MaxWeightSSE4(__m128i w) {
-	__m128i max2 = _mm_max_epi32(w, _mm_shuffle_epi32(w, _MM_SHUFFLE(3, 2, 3, 2)));
-	__m128i max1 = _mm_max_epi32(max2, _mm_shuffle_epi32(max2, _MM_SHUFFLE(1, 1, 1, 1)));
-	return _mm_cvtsi128_si32(max1);
-}
-#endif
-
 template <bool useSSE4>
-void TriangleEdge<useSSE4>::NarrowMinMaxX(const Vec4<int> &w, int64_t minX, int64_t &rowMinX, int64_t &rowMaxX) {
-	int wmax;
+inline Vec4<int> TriangleEdge<useSSE4>::StepBlockX(const Vec4<int> &w) {
 #if defined(_M_SSE) && !PPSSPP_ARCH(X86)
-	if constexpr (useSSE4) {
-		wmax = MaxWeightSSE4(w.ivec);
-	} else {
-		wmax = std::max(std::max(w.x, w.y), std::max(w.z, w.w));
-	}
+	return _mm_add_epi32(w.ivec, blockStepX.ivec);
 #elif PPSSPP_ARCH(ARM64_NEON)
-	int32x2_t wmax_temp = vpmax_s32(vget_low_s32(w.ivec), vget_high_s32(w.ivec));
-	wmax = vget_lane_s32(vpmax_s32(wmax_temp, wmax_temp), 0);
+	return vaddq_s32(w.ivec, blockStepX.ivec);
 #else
-	wmax = std::max(std::max(w.x, w.y), std::max(w.z, w.w));
+	return w + blockStepX;
 #endif
-	if (wmax < 0) {
-		if (stepX.x > 0) {
-			int steps = -wmax / stepX.x;
-			rowMinX = std::max(rowMinX, minX + steps * SCREEN_SCALE_FACTOR * 2);
-		} else if (stepX.x <= 0) {
-			rowMinX = rowMaxX + 1;
-		}
-	}
-
-	if (wmax >= 0 && stepX.x < 0) {
-		int steps = (-wmax / stepX.x) + 1;
-		rowMaxX = std::min(rowMaxX, minX + steps * SCREEN_SCALE_FACTOR * 2);
-	}
 }
 
-#if defined(_M_SSE) && !PPSSPP_ARCH(X86)
-#if defined(__GNUC__) || defined(__clang__) || defined(__INTEL_COMPILER)
-[[gnu::target("sse4.1")]]
-#endif
-static inline __m128i SOFTRAST_CALL StepTimesSSE4(__m128i w, __m128i step, int c) {
-	return _mm_add_epi32(w, _mm_mullo_epi32(_mm_set1_epi32(c), step));
-}
-#endif
-
 template <bool useSSE4>
-inline Vec4<int> TriangleEdge<useSSE4>::StepXTimes(const Vec4<int> &w, int c) {
+inline Vec4<int> TriangleEdge<useSSE4>::BlockCorners(const Vec4<int> &w) {
 #if defined(_M_SSE) && !PPSSPP_ARCH(X86)
-	if constexpr (useSSE4)
-		return StepTimesSSE4(w.ivec, stepX.ivec, c);
+	return _mm_add_epi32(_mm_shuffle_epi32(w.ivec, _MM_SHUFFLE(0, 0, 0, 0)), cornerOffsets.ivec);
 #elif PPSSPP_ARCH(ARM64_NEON)
-	return vaddq_s32(w.ivec, vmulq_s32(vdupq_n_s32(c), stepX.ivec));
+	return vaddq_s32(vdupq_laneq_s32(w.ivec, 0), cornerOffsets.ivec);
+#else
+	return Vec4<int>::AssignToAll(w.x) + cornerOffsets;
 #endif
-	return w + stepX * c;
 }
 
 static inline Vec4<int> MakeMask(const Vec4<int> &w0, const Vec4<int> &w1, const Vec4<int> &w2, const Vec4<int> &bias0, const Vec4<int> &bias1, const Vec4<int> &bias2, const Vec4<int> &scissor) {
@@ -956,6 +937,38 @@ static inline bool AnyMask(const Vec4<int> &mask) {
 #endif
 }
 
+// True if every lane of the mask passes.
+static inline bool AllMask(const Vec4<int> &mask) {
+#if PPSSPP_ARCH(ARM64_NEON)
+	int64x2_t sig = vreinterpretq_s64_s32(vshrq_n_s32(mask.ivec, 31));
+	return vgetq_lane_s64(sig, 0) == 0 && vgetq_lane_s64(sig, 1) == 0;
+#else
+	return mask.x >= 0 && mask.y >= 0 && mask.z >= 0 && mask.w >= 0;
+#endif
+}
+
+// Takes the edge weights at the block's corners.
+template <bool useSSE4>
+static inline BlockCoverage ClassifyBlock(const Vec4<int> &c0, const Vec4<int> &c1, const Vec4<int> &c2, const Vec4<int> &bias0, const Vec4<int> &bias1, const Vec4<int> &bias2) {
+#if defined(_M_SSE) && !PPSSPP_ARCH(X86)
+	// Sign bits are set for corners outside the edge.
+	int outside0 = _mm_movemask_ps(_mm_castsi128_ps(_mm_add_epi32(c0.ivec, bias0.ivec)));
+	int outside1 = _mm_movemask_ps(_mm_castsi128_ps(_mm_add_epi32(c1.ivec, bias1.ivec)));
+	int outside2 = _mm_movemask_ps(_mm_castsi128_ps(_mm_add_epi32(c2.ivec, bias2.ivec)));
+	// If every corner is outside any one edge, so is the whole block.
+	if (outside0 == 15 || outside1 == 15 || outside2 == 15)
+		return BlockCoverage::OUTSIDE;
+	return (outside0 | outside1 | outside2) == 0 ? BlockCoverage::INSIDE : BlockCoverage::PARTIAL;
+#else
+	Vec4<int> biased0 = c0 + bias0;
+	Vec4<int> biased1 = c1 + bias1;
+	Vec4<int> biased2 = c2 + bias2;
+	if (!AnyMask<useSSE4>(biased0) || !AnyMask<useSSE4>(biased1) || !AnyMask<useSSE4>(biased2))
+		return BlockCoverage::OUTSIDE;
+	return AllMask(biased0 | biased1 | biased2) ? BlockCoverage::INSIDE : BlockCoverage::PARTIAL;
+#endif
+}
+
 static inline Vec4<float> EdgeRecip(const Vec4<int> &w0, const Vec4<int> &w1, const Vec4<int> &w2) {
 #if defined(_M_SSE) && !PPSSPP_ARCH(X86)
 	__m128i wsum = _mm_add_epi32(w0.ivec, _mm_add_epi32(w1.ivec, w2.ivec));
@@ -1027,164 +1040,184 @@ void DrawTriangleSlice(
 	const Vec4<int> minz = Vec4<int>::AssignToAll(pixelID.cached.minz);
 	const Vec4<int> maxz = Vec4<int>::AssignToAll(pixelID.cached.maxz);
 
+	const int numBlocksX = (int)((maxX - minX) / BLOCK_SCREEN_SIZE) + 1;
+	BlockCoverage blockCoverage[MAX_BLOCKS_X];
+
+	int quadY = 0;
 	for (int64_t curY = minY; curY <= maxY; curY += SCREEN_SCALE_FACTOR * 2,
 										w0_base = e0.StepY(w0_base),
 										w1_base = e1.StepY(w1_base),
-										w2_base = e2.StepY(w2_base)) {
-		Vec4<int> w0 = w0_base;
-		Vec4<int> w1 = w1_base;
-		Vec4<int> w2 = w2_base;
-
-		DrawingCoords p = TransformUnit::ScreenToDrawing(minX, curY);
-
-		int64_t rowMinX = minX, rowMaxX = maxX;
-		e0.NarrowMinMaxX(w0, minX, rowMinX, rowMaxX);
-		e1.NarrowMinMaxX(w1, minX, rowMinX, rowMaxX);
-		e2.NarrowMinMaxX(w2, minX, rowMinX, rowMaxX);
-
-		int skipX = (rowMinX - minX) / (SCREEN_SCALE_FACTOR * 2);
-		w0 = e0.StepXTimes(w0, skipX);
-		w1 = e1.StepXTimes(w1, skipX);
-		w2 = e2.StepXTimes(w2, skipX);
-		p.x = (p.x + 2 * skipX) & 0x3FF;
+										w2_base = e2.StepY(w2_base),
+										++quadY) {
+		if ((quadY % BLOCK_QUADS) == 0) {
+			Vec4<int> c0 = e0.BlockCorners(w0_base);
+			Vec4<int> c1 = e1.BlockCorners(w1_base);
+			Vec4<int> c2 = e2.BlockCorners(w2_base);
+			for (int block = 0; block < std::min(numBlocksX, MAX_BLOCKS_X); ++block) {
+				blockCoverage[block] = ClassifyBlock<useSSE4>(c0, c1, c2, bias0, bias1, bias2);
+				c0 = e0.StepBlockX(c0);
+				c1 = e1.StepBlockX(c1);
+				c2 = e2.StepBlockX(c2);
+			}
+		}
 
 		// TODO: Maybe we can clip the edges instead?
 		int scissorYPlus1 = curY + SCREEN_SCALE_FACTOR > maxY ? -1 : 0;
-		Vec4<int> scissor_mask = Vec4<int>(0, rowMaxX - rowMinX - SCREEN_SCALE_FACTOR, scissorYPlus1, (rowMaxX - rowMinX - SCREEN_SCALE_FACTOR) | scissorYPlus1);
 		Vec4<int> scissor_step = Vec4<int>(0, -(SCREEN_SCALE_FACTOR * 2), 0, -(SCREEN_SCALE_FACTOR * 2));
 
-		for (int64_t curX = rowMinX; curX <= rowMaxX; curX += SCREEN_SCALE_FACTOR * 2,
-			w0 = e0.StepX(w0),
-			w1 = e1.StepX(w1),
-			w2 = e2.StepX(w2),
-			scissor_mask = scissor_mask + scissor_step,
-			p.x = (p.x + 2) & 0x3FF) {
-
-			// If p is on or inside all edges, render pixel
-			Vec4<int> mask = MakeMask(w0, w1, w2, bias0, bias1, bias2, scissor_mask);
-			if (AnyMask<useSSE4>(mask)) {
-				Vec4<int> z;
-				if (flatZ) {
-					z = Vec4<int>::AssignToAll(v2.screenpos.z);
-				} else {
-					// Z is interpolated pretty much directly.
-					Vec4<float> zfloats = w0.Cast<float>() * v0_z4 + w1.Cast<float>() * v1_z4 + w2.Cast<float>() * v2_z4;
-					z = (zfloats * wsum_recip).Cast<int>();
-				}
+		Vec4<int> w0_block = w0_base;
+		Vec4<int> w1_block = w1_base;
+		Vec4<int> w2_block = w2_base;
+		int64_t blockX = minX;
+		for (int block = 0; block < numBlocksX; ++block, blockX += BLOCK_SCREEN_SIZE,
+											w0_block = e0.StepBlockX(w0_block),
+											w1_block = e1.StepBlockX(w1_block),
+											w2_block = e2.StepBlockX(w2_block)) {
+			const BlockCoverage coverage = block < MAX_BLOCKS_X ? blockCoverage[block] : BlockCoverage::PARTIAL;
+			if (coverage == BlockCoverage::OUTSIDE)
+				continue;
+
+			Vec4<int> w0 = w0_block;
+			Vec4<int> w1 = w1_block;
+			Vec4<int> w2 = w2_block;
+
+			DrawingCoords p = TransformUnit::ScreenToDrawing(blockX, curY);
+			int64_t blockMaxX = std::min(maxX, blockX + BLOCK_SCREEN_SIZE - 1);
+			Vec4<int> scissor_mask = Vec4<int>(0, maxX - blockX - SCREEN_SCALE_FACTOR, scissorYPlus1, (maxX - blockX - SCREEN_SCALE_FACTOR) | scissorYPlus1);
+
+			for (int64_t curX = blockX; curX <= blockMaxX; curX += SCREEN_SCALE_FACTOR * 2,
+				w0 = e0.StepX(w0),
+				w1 = e1.StepX(w1),
+				w2 = e2.StepX(w2),
+				scissor_mask = scissor_mask + scissor_step,
+				p.x = (p.x + 2) & 0x3FF) {
+
+				// If p is on or inside all edges, render pixel.  Inside the block, only the scissor matters.
+				Vec4<int> mask = coverage == BlockCoverage::INSIDE ? scissor_mask : MakeMask(w0, w1, w2, bias0, bias1, bias2, scissor_mask);
+				if (AnyMask<useSSE4>(mask)) {
+					Vec4<int> z;
+					if (flatZ) {
+						z = Vec4<int>::AssignToAll(v2.screenpos.z);
+					} else {
+						// Z is interpolated pretty much directly.
+						Vec4<float> zfloats = w0.Cast<float>() * v0_z4 + w1.Cast<float>() * v1_z4 + w2.Cast<float>() * v2_z4;
+						z = (zfloats * wsum_recip).Cast<int>();
+					}
 
-				if (pixelID.earlyZChecks) {
-					if (pixelID.applyDepthRange) {
+					if (pixelID.earlyZChecks) {
+						if (pixelID.applyDepthRange) {
 #if defined(_M_SSE)
-						mask.ivec = _mm_or_si128(mask.ivec, _mm_or_si128(_mm_cmplt_epi32(z.ivec, minz.ivec), _mm_cmpgt_epi32(z.ivec, maxz.ivec)));
+							mask.ivec = _mm_or_si128(mask.ivec, _mm_or_si128(_mm_cmplt_epi32(z.ivec, minz.ivec), _mm_cmpgt_epi32(z.ivec, maxz.ivec)));
 #else
-						for (int i = 0; i < 4; ++i) {
-							if (z[i] < minz[i] || z[i] > maxz[i])
-								mask[i] = -1;
-						}
+							for (int i = 0; i < 4; ++i) {
+								if (z[i] < minz[i] || z[i] > maxz[i])
+									mask[i] = -1;
+							}
 #endif
+						}
+						mask = CheckDepthTestPassed4(mask, pixelID.DepthTestFunc(), p.x, p.y, pixelID.cached.depthbufStride, z);
+						if (!AnyMask<useSSE4>(mask))
+							continue;
 					}
-					mask = CheckDepthTestPassed4(mask, pixelID.DepthTestFunc(), p.x, p.y, pixelID.cached.depthbufStride, z);
-					if (!AnyMask<useSSE4>(mask))
-						continue;
-				}
 
-				// Color interpolation is not perspective corrected on the PSP.
-				Vec4<int> prim_color[4];
-				if (!flatColor0) {
-					for (int i = 0; i < 4; ++i) {
-						if (mask[i] >= 0)
-							prim_color[i] = Interpolate(v0_c0, v1_c0, v2_c0, w0[i], w1[i], w2[i], wsum_recip[i]);
-					}
-				} else {
-					for (int i = 0; i < 4; ++i) {
-						prim_color[i] = v2_c0;
-					}
-				}
-				Vec3<int> sec_color[4];
-				if (!flatColor1) {
-					for (int i = 0; i < 4; ++i) {
-						if (mask[i] >= 0)
-							sec_color[i] = Interpolate(v0_c1, v1_c1, v2_c1, w0[i], w1[i], w2[i], wsum_recip[i]);
-					}
-				} else {
-					for (int i = 0; i < 4; ++i) {
-						sec_color[i] = v2_c1;
+					// Color interpolation is not perspective corrected on the PSP.
+					Vec4<int> prim_color[4];
+					if (!flatColor0) {
+						for (int i = 0; i < 4; ++i) {
+							if (mask[i] >= 0)
+								prim_color[i] = Interpolate(v0_c0, v1_c0, v2_c0, w0[i], w1[i], w2[i], wsum_recip[i]);
+						}
+					} else {
+						for (int i = 0; i < 4; ++i) {
+							prim_color[i] = v2_c0;
+						}
 					}
-				}
-
-				if (state.enableTextures) {
-					if constexpr (!clearMode) {
-						Vec4<float> s, t;
-						if (state.throughMode) {
-							s = Interpolate(v0.texturecoords.s(), v1.texturecoords.s(), v2.texturecoords.s(), w0, w1,
-											w2, wsum_recip);
-							t = Interpolate(v0.texturecoords.t(), v1.texturecoords.t(), v2.texturecoords.t(), w0, w1,
-											w2, wsum_recip);
-
-							// For levels > 0, mipmapping is always based on level 0.  Simpler to scale first.
-							s *= 1.0f / (float) (1 << state.samplerID.width0Shift);
-							t *= 1.0f / (float) (1 << state.samplerID.height0Shift);
-						} else if (state.textureProj) {
-							// Texture coordinate interpolation must definitely be perspective-correct.
-							GetTextureCoordinatesProj(v0, v1, v2, w0, w1, w2, wsum_recip, s, t);
-						} else {
-							// Texture coordinate interpolation must definitely be perspective-correct.
-							GetTextureCoordinates(v0, v1, v2, w0, w1, w2, wsum_recip, s, t);
+					Vec3<int> sec_color[4];
+					if (!flatColor1) {
+						for (int i = 0; i < 4; ++i) {
+							if (mask[i] >= 0)
+								sec_color[i] = Interpolate(v0_c1, v1_c1, v2_c1, w0[i], w1[i], w2[i], wsum_recip[i]);
+						}
+					} else {
+						for (int i = 0; i < 4; ++i) {
+							sec_color[i] = v2_c1;
 						}
+					}
 
-						if (state.TexLevelMode() == GE_TEXLEVEL_MODE_SLOPE) {
-							// Not sure what's right, but we need one value for the slope.
-							float clipw = (v0.clipw * w0.x + v1.clipw * w1.x + v2.clipw * w2.x) * wsum_recip.x;
-							ApplyTexturing(state, prim_color, mask, s, t, clipw);
-						} else {
-							ApplyTexturing(state, prim_color, mask, s, t, 0.0f);
+					if (state.enableTextures) {
+						if constexpr (!clearMode) {
+							Vec4<float> s, t;
+							if (state.throughMode) {
+								s = Interpolate(v0.texturecoords.s(), v1.texturecoords.s(), v2.texturecoords.s(), w0, w1,
+												w2, wsum_recip);
+								t = Interpolate(v0.texturecoords.t(), v1.texturecoords.t(), v2.texturecoords.t(), w0, w1,
+												w2, wsum_recip);
+
+								// For levels > 0, mipmapping is always based on level 0.  Simpler to scale first.
+								s *= 1.0f / (float) (1 << state.samplerID.width0Shift);
+								t *= 1.0f / (float) (1 << state.samplerID.height0Shift);
+							} else if (state.textureProj) {
+								// Texture coordinate interpolation must definitely be perspective-correct.
+								GetTextureCoordinatesProj(v0, v1, v2, w0, w1, w2, wsum_recip, s, t);
+							} else {
+								// Texture coordinate interpolation must definitely be perspective-correct.
+								GetTextureCoordinates(v0, v1, v2, w0, w1, w2, wsum_recip, s, t);
+							}
+
+							if (state.TexLevelMode() == GE_TEXLEVEL_MODE_SLOPE) {
+								// Not sure what's right, but we need one value for the slope.
+								float clipw = (v0.clipw * w0.x + v1.clipw * w1.x + v2.clipw * w2.x) * wsum_recip.x;
+								ApplyTexturing(state, prim_color, mask, s, t, clipw);
+							} else {
+								ApplyTexturing(state, prim_color, mask, s, t, 0.0f);
+							}
 						}
 					}
-				}
 
-				if constexpr (!clearMode) {
-					for (int i = 0; i < 4; ++i) {
+					if constexpr (!clearMode) {
+						for (int i = 0; i < 4; ++i) {
 #if defined(_M_SSE)
-						// TODO: Tried making Vec4 do this, but things got slower.
-						const __m128i sec = _mm_and_si128(sec_color[i].ivec, _mm_set_epi32(0, -1, -1, -1));
-						prim_color[i].ivec = _mm_add_epi32(prim_color[i].ivec, sec);
+							// TODO: Tried making Vec4 do this, but things got slower.
+							const __m128i sec = _mm_and_si128(sec_color[i].ivec, _mm_set_epi32(0, -1, -1, -1));
+							prim_color[i].ivec = _mm_add_epi32(prim_color[i].ivec, sec);
 #elif PPSSPP_ARCH(ARM64_NEON)
-						int32x4_t sec = vsetq_lane_s32(0, sec_color[i].ivec, 3);
-						prim_color[i].ivec = vaddq_s32(prim_color[i].ivec, sec);
+							int32x4_t sec = vsetq_lane_s32(0, sec_color[i].ivec, 3);
+							prim_color[i].ivec = vaddq_s32(prim_color[i].ivec, sec);
 #else
-						prim_color[i] += Vec4<int>(sec_color[i], 0);
+							prim_color[i] += Vec4<int>(sec_color[i], 0);
 #endif
+						}
 					}
-				}
 
-				Vec4<int> fog = Vec4<int>::AssignToAll(255);
-				if (!noFog) {
-					Vec4<float> fogdepths = w0.Cast<float>() * v0.fogdepth + w1.Cast<float>() * v1.fogdepth + w2.Cast<float>() * v2.fogdepth;
-					fogdepths = fogdepths * wsum_recip;
-					for (int i = 0; i < 4; ++i) {
-						fog[i] = ClampFogDepth(fogdepths[i]);
+					Vec4<int> fog = Vec4<int>::AssignToAll(255);
+					if (!noFog) {
+						Vec4<float> fogdepths = w0.Cast<float>() * v0.fogdepth + w1.Cast<float>() * v1.fogdepth + w2.Cast<float>() * v2.fogdepth;
+						fogdepths = fogdepths * wsum_recip;
+						for (int i = 0; i < 4; ++i) {
+							fog[i] = ClampFogDepth(fogdepths[i]);
+						}
 					}
-				}
 
-				PROFILE_THIS_SCOPE("draw_tri_px");
-				DrawingCoords subp = p;
-				for (int i = 0; i < 4; ++i) {
-					if (mask[i] < 0) {
-						continue;
-					}
-					subp.x = p.x + (i & 1);
-					subp.y = p.y + (i / 2);
+					PROFILE_THIS_SCOPE("draw_tri_px");
+					DrawingCoords subp = p;
+					for (int i = 0; i < 4; ++i) {
+						if (mask[i] < 0) {
+							continue;
+						}
+						subp.x = p.x + (i & 1);
+						subp.y = p.y + (i / 2);
 
-					state.drawPixel(subp.x, subp.y, z[i], fog[i], ToVec4IntArg(prim_color[i]), pixelID);
+						state.drawPixel(subp.x, subp.y, z[i], fog[i], ToVec4IntArg(prim_color[i]), pixelID);
 
 #if defined(SOFTGPU_MEMORY_TAGGING_DETAILED)
-					uint32_t row = gstate.getFrameBufAddress() + subp.y * pixelID.cached.framebufStride * bpp;
-					NotifyMemInfo(MemBlockFlags::WRITE, row + subp.x * bpp, bpp, tag.c_str(), tag.size());
-					if (pixelID.depthWrite) {
-						row = gstate.getDepthBufAddress() + subp.y * pixelID.cached.depthbufStride * 2;
-						NotifyMemInfo(MemBlockFlags::WRITE, row + subp.x * 2, 2, ztag.c_str(), ztag.size());
-					}
+						uint32_t row = gstate.getFrameBufAddress() + subp.y * pixelID.cached.framebufStride * bpp;
+						NotifyMemInfo(MemBlockFlags::WRITE, row + subp.x * bpp, bpp, tag.c_str(), tag.size());
+						if (pixelID.depthWrite) {
+							row = gstate.getDepthBufAddress() + subp.y * pixelID.cached.depthbufStride * 2;
+							NotifyMemInfo(MemBlockFlags::WRITE, row + subp.x * 2, 2, ztag.c_str(), ztag.size());
+						}
 #endif
+					}
 				}
 			}
 		}
@@ -47,6 +47,7 @@
 #include "Common/GPU/ShaderTranslation.h"
 #include "GPU/Common/SplineCommon.h"
 #include "GPU/Debugger/Record.h"
+#include "ext/xxhash.h"
 
 const int FB_WIDTH = 480;
 const int FB_HEIGHT = 272;
@@ -457,11 +458,8 @@ SoftGPU::SoftGPU(GraphicsContext *gfxCtx, Draw::DrawContext *draw)
 void SoftGPU::DeviceLost() {
 	if (presentation_)
 		presentation_->DeviceLost();
+	ReleasePresentTextures();
 	draw_ = nullptr;
-	if (fbTex) {
-		fbTex->Release();
-		fbTex = nullptr;
-	}
 }
 
 void SoftGPU::DeviceRestore(Draw::DrawContext *draw) {
@@ -472,10 +470,7 @@ void SoftGPU::DeviceRestore(Draw::DrawContext *draw) {
 }
 
 SoftGPU::~SoftGPU() {
-	if (fbTex) {
-		fbTex->Release();
-		fbTex = nullptr;
-	}
+	ReleasePresentTextures();
 
 	delete presentation_;
 	delete drawEngine_;
@@ -495,17 +490,66 @@ void SoftGPU::SetDisplayFramebuffer(u32 framebuf, u32 stride, GEBufferFormat for
 
 DSStretch g_DarkStalkerStretch;
 
+Draw::Texture *SoftGPU::GetPresentTexture(const Draw::TextureDesc &desc) {
+	int frameNumber = draw_->GetFrameCount();
+	for (auto it = presentTextures_.begin(); it != presentTextures_.end(); ) {
+		Draw::Texture *tex = it->tex;
+		// Can't update one an in-flight frame might still be drawing from.
+		if (it->frameNumber >= frameNumber - 3 || tex->Width() != desc.width || tex->Height() != desc.height || tex->Format() != desc.format) {
+			if (frameNumber - it->frameNumber > 10) {
+				// Probably left over from a different size or format.
+				tex->Release();
+				it = presentTextures_.erase(it);
+			} else {
+				++it;
+			}
+			continue;
+		}
+
+		draw_->UpdateTextureLevels(tex, (const uint8_t **)desc.initData.data(), nullptr, 1);
+		it->frameNumber = frameNumber;
+		return tex;
+	}
+
+	Draw::Texture *tex = draw_->CreateTexture(desc);
+	if (tex)
+		presentTextures_.push_back(PresentTexture{ tex, frameNumber });
+	return tex;
+}
+
+void SoftGPU::ReleasePresentTextures() {
+	for (auto &iter : presentTextures_)
+		iter.tex->Release();
+	presentTextures_.clear();
+}
+
 void SoftGPU::ConvertTextureDescFrom16(Draw::TextureDesc &desc, int srcwidth, int srcheight, const uint16_t *overrideData) {
 	// TODO: This should probably be converted in a shader instead..
-	fbTexBuffer_.resize(srcwidth * srcheight);
 	const uint16_t *displayBuffer = overrideData;
 	if (!displayBuffer)
 		displayBuffer = (const uint16_t *)Memory::GetPointer(displayFramebuf_);
 
+	if (fbTexBufferSource_ != displayBuffer || fbTexBufferStride_ != displayStride_ || fbTexBufferFormat_ != displayFormat_ || fbTexBuffer_.size() != (size_t)(srcwidth * srcheight)) {
+		fbTexBuffer_.resize(srcwidth * srcheight);
+		fbTexRowHashes_.clear();
+		fbTexBufferSource_ = displayBuffer;
+		fbTexBufferStride_ = displayStride_;
+		fbTexBufferFormat_ = displayFormat_;
+	}
+	// Empty means nothing was converted yet.
+	bool rowsValid = !fbTexRowHashes_.empty();
+	fbTexRowHashes_.resize(srcheight);
+
 	for (int y = 0; y < srcheight; ++y) {
 		u32 *buf_line = &fbTexBuffer_[y * srcwidth];
 		const u16 *fb_line = &displayBuffer[y * displayStride_];
 
+		// Games often only redraw part of the screen, or nothing at all (like menus.)
+		uint64_t hash = XXH3_64bits(fb_line, srcwidth * sizeof(u16));
+		if (rowsValid && fbTexRowHashes_[y] == hash)
+			continue;
+		fbTexRowHashes_[y] = hash;
+
 		switch (displayFormat_) {
 		case GE_FORMAT_565:
 			ConvertRGB565ToRGBA8888(buf_line, fb_line, srcwidth);
@@ -539,11 +583,6 @@ void SoftGPU::CopyToCurrentFboFromDisplayRam(int srcwidth, int srcheight) {
 	float v0 = 0.0f;
 	float v1 = 1.0f;
 
-	if (fbTex) {
-		fbTex->Release();
-		fbTex = nullptr;
-	}
-
 	// For accuracy, try to handle 0 stride - sometimes used.
 	if (displayStride_ == 0) {
 		srcheight = 1;
@@ -628,7 +667,9 @@ void SoftGPU::CopyToCurrentFboFromDisplayRam(int srcwidth, int srcheight) {
 		return;
 	}
 
-	fbTex = draw_->CreateTexture(desc);
+	Draw::Texture *fbTex = GetPresentTexture(desc);
+	if (!fbTex)
+		return;
 
 	switch (GetGPUBackend()) {
 	case GPUBackend::OPENGL:
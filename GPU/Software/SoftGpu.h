@@ -215,6 +215,8 @@ class SoftGPU : public GPUCommon {
 protected:
 	void FastRunLoop(DisplayList &list) override;
 	void CopyToCurrentFboFromDisplayRam(int srcwidth, int srcheight);
+	Draw::Texture *GetPresentTexture(const Draw::TextureDesc &desc);
+	void ReleasePresentTextures();
 	void ConvertTextureDescFrom16(Draw::TextureDesc &desc, int srcwidth, int srcheight, const uint16_t *overrideData = nullptr);
 
 	void BuildReportingInfo() override {}
@@ -238,8 +240,19 @@ class SoftGPU : public GPUCommon {
 	PresentationCommon *presentation_ = nullptr;
 	SoftwareDrawEngine *drawEngine_ = nullptr;
 
-	Draw::Texture *fbTex = nullptr;
+	// Presentation textures get reused once the GPU is surely done with them, instead of created each frame.
+	struct PresentTexture {
+		Draw::Texture *tex;
+		int frameNumber;
+	};
+	std::vector<PresentTexture> presentTextures_;
+
+	// Converted from 16-bit, kept between frames so only rows that changed get converted again.
 	std::vector<u32> fbTexBuffer_;
+	std::vector<uint64_t> fbTexRowHashes_;
+	const void *fbTexBufferSource_ = nullptr;
+	u32 fbTexBufferStride_ = 0;
+	GEBufferFormat fbTexBufferFormat_ = GE_FORMAT_INVALID;
 };
 
 // TODO: These shouldn't be global.
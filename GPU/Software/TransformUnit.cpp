@@ -350,12 +350,8 @@ static inline float Dot43(const Vec4f &a, const Vec3f &b) {
 	return Dot(a, Vec4f(b, 1.0f));
 }
 
-ClipVertexData TransformUnit::ReadVertex(const VertexReader &vreader, const TransformState &state) {
-	PROFILE_THIS_SCOPE("read_vert");
-	// If we ever thread this, we'll have to change this.
-	ClipVertexData vertex;
-
-	ModelCoords pos;
+// Reads everything but the position transform, shared by ReadVertex() and ReadVertices().
+static inline void ReadVertexInputs(const VertexReader &vreader, const TransformState &state, ClipVertexData &vertex, ModelCoords &pos, Vec3f &normal) {
 	// VertexDecoder normally scales z, but we want it unscaled.
 	vreader.ReadPosThroughZ16(pos.AsArray());
 
@@ -371,7 +367,7 @@ ClipVertexData TransformUnit::ReadVertex(const VertexReader &vreader, const Tran
 	static Vec3f lastnormal;
 	if (vreader.hasNormal())
 		vreader.ReadNrm(lastnormal.AsArray());
-	Vec3f normal = lastnormal;
+	normal = lastnormal;
 	if (state.negateNormals)
 		normal = -normal;
 
@@ -382,6 +378,73 @@ ClipVertexData TransformUnit::ReadVertex(const VertexReader &vreader, const Tran
 	}
 
 	vertex.v.color1 = 0;
+}
+
+// Everything after clippos is set and the position is scaled to the viewport.
+static inline void FinishTransformedVertex(ClipVertexData &vertex, const ModelCoords &pos, const Vec3f &normal, const WorldCoords &worldpos, const Vec3f &screenScaled, const TransformState &state) {
+	bool outside_range_flag = false;
+	vertex.v.screenpos = state.roundToScreen(screenScaled, vertex.clippos, &outside_range_flag);
+	if (outside_range_flag) {
+		// We use this, essentially, as the flag.
+		vertex.v.screenpos.x = 0x7FFFFFFF;
+		return;
+	}
+
+	if (state.enableFog) {
+		vertex.v.fogdepth = Dot43(state.posToFog, pos);
+	} else {
+		vertex.v.fogdepth = 1.0f;
+	}
+	vertex.v.clipw = vertex.clippos.w;
+
+	Vec3<float> worldnormal;
+	if (state.lightingState.usesWorldNormal) {
+		worldnormal = TransformUnit::ModelToWorldNormal(normal);
+		worldnormal.NormalizeOr001();
+	}
+
+	// Time to generate some texture coords.  Lighting will handle shade mapping.
+	if (state.uvGenMode == GE_TEXMAP_TEXTURE_MATRIX) {
+		Vec3f source;
+		switch (gstate.getUVProjMode()) {
+		case GE_PROJMAP_POSITION:
+			source = pos;
+			break;
+
+		case GE_PROJMAP_UV:
+			source = Vec3f(vertex.v.texturecoords.uv(), 0.0f);
+			break;
+
+		case GE_PROJMAP_NORMALIZED_NORMAL:
+			// This does not use 0, 0, 1 if length is zero.
+			source = normal.Normalized(cpu_info.bSSE4_1);
+			break;
+
+		case GE_PROJMAP_NORMAL:
+			source = normal;
+			break;
+		}
+
+		// Note that UV scale/offset are not used in this mode.
+		Vec3<float> stq = Vec3ByMatrix43(source, gstate.tgenMatrix);
+		vertex.v.texturecoords = Vec3Packedf(stq.x, stq.y, stq.z);
+	} else if (state.uvGenMode == GE_TEXMAP_ENVIRONMENT_MAP) {
+		Lighting::GenerateLightST(vertex.v, worldnormal);
+	}
+
+	PROFILE_THIS_SCOPE("light");
+	if (state.enableLighting)
+		Lighting::Process(vertex.v, worldpos, worldnormal, state.lightingState);
+}
+
+ClipVertexData TransformUnit::ReadVertex(const VertexReader &vreader, const TransformState &state) {
+	PROFILE_THIS_SCOPE("read_vert");
+	// If we ever thread this, we'll have to change this.
+	ClipVertexData vertex;
+
+	ModelCoords pos;
+	Vec3f normal;
+	ReadVertexInputs(vreader, state, vertex, pos, normal);
 
 	if (state.enableTransform) {
 		WorldCoords worldpos;
@@ -405,59 +468,7 @@ ClipVertexData TransformUnit::ReadVertex(const VertexReader &vreader, const Tran
 #else
 		screenScaled = vertex.clippos.xyz() * state.screenScale / vertex.clippos.w + state.screenAdd;
 #endif
-		bool outside_range_flag = false;
-		vertex.v.screenpos = state.roundToScreen(screenScaled, vertex.clippos, &outside_range_flag);
-		if (outside_range_flag) {
-			// We use this, essentially, as the flag.
-			vertex.v.screenpos.x = 0x7FFFFFFF;
-			return vertex;
-		}
-
-		if (state.enableFog) {
-			vertex.v.fogdepth = Dot43(state.posToFog, pos);
-		} else {
-			vertex.v.fogdepth = 1.0f;
-		}
-		vertex.v.clipw = vertex.clippos.w;
-
-		Vec3<float> worldnormal;
-		if (state.lightingState.usesWorldNormal) {
-			worldnormal = TransformUnit::ModelToWorldNormal(normal);
-			worldnormal.NormalizeOr001();
-		}
-
-		// Time to generate some texture coords.  Lighting will handle shade mapping.
-		if (state.uvGenMode == GE_TEXMAP_TEXTURE_MATRIX) {
-			Vec3f source;
-			switch (gstate.getUVProjMode()) {
-			case GE_PROJMAP_POSITION:
-				source = pos;
-				break;
-
-			case GE_PROJMAP_UV:
-				source = Vec3f(vertex.v.texturecoords.uv(), 0.0f);
-				break;
-
-			case GE_PROJMAP_NORMALIZED_NORMAL:
-				// This does not use 0, 0, 1 if length is zero.
-				source = normal.Normalized(cpu_info.bSSE4_1);
-				break;
-
-			case GE_PROJMAP_NORMAL:
-				source = normal;
-				break;
-			}
-
-			// Note that UV scale/offset are not used in this mode.
-			Vec3<float> stq = Vec3ByMatrix43(source, gstate.tgenMatrix);
-			vertex.v.texturecoords = Vec3Packedf(stq.x, stq.y, stq.z);
-		} else if (state.uvGenMode == GE_TEXMAP_ENVIRONMENT_MAP) {
-			Lighting::GenerateLightST(vertex.v, worldnormal);
-		}
-
-		PROFILE_THIS_SCOPE("light");
-		if (state.enableLighting)
-			Lighting::Process(vertex.v, worldpos, worldnormal, state.lightingState);
+		FinishTransformedVertex(vertex, pos, normal, worldpos, screenScaled, state);
 	} else {
 		vertex.v.screenpos.x = (int)(pos[0] * SCREEN_SCALE_FACTOR);
 		vertex.v.screenpos.y = (int)(pos[1] * SCREEN_SCALE_FACTOR);
@@ -469,6 +480,81 @@ ClipVertexData TransformUnit::ReadVertex(const VertexReader &vreader, const Tran
 	return vertex;
 }
 
+static inline Vec4f DivideLanes(const Vec4f &a, const Vec4f &b) {
+#if defined(_M_SSE)
+	return _mm_div_ps(a.vec, b.vec);
+#elif PPSSPP_ARCH(ARM64_NEON)
+	return vdivq_f32(a.vec, b.vec);
+#else
+	return Vec4f(a.x / b.x, a.y / b.y, a.z / b.z, a.w / b.w);
+#endif
+}
+
+// Same as (c0 * x + c1 * y) + (c2 * z + c3) per lane, which matches the order in Vec3ByMatrix44/43.
+static inline Vec4f MatrixRowLanes(const Vec4f &x, const Vec4f &y, const Vec4f &z, float c0, float c1, float c2, float c3) {
+	return (x * Vec4f::AssignToAll(c0) + y * Vec4f::AssignToAll(c1)) + (z * Vec4f::AssignToAll(c2) + Vec4f::AssignToAll(c3));
+}
+
+void TransformUnit::ReadVertices(VertexReader &vreader, const TransformState &state, int count, ClipVertexData *out) {
+	if (!state.enableTransform) {
+		for (int i = 0; i < count; ++i) {
+			vreader.Goto(i);
+			out[i] = ReadVertex(vreader, state);
+		}
+		return;
+	}
+
+	PROFILE_THIS_SCOPE("read_verts");
+	const float *m = state.matrix;
+	const float *w = gstate.worldMatrix;
+	const bool toWorld = MatrixMode(state.matrixMode) == MatrixMode::WORLD_TO_CLIP;
+
+	// Positions go through the matrices four at a time, one vertex per lane.
+	// The rest (fog, uv gen, lighting) is already SIMD within a vertex, so stays per vertex.
+	ModelCoords pos[4];
+	Vec3f normal[4];
+	WorldCoords worldpos[4];
+	for (int base = 0; base < count; base += 4) {
+		const int n = std::min(4, count - base);
+		for (int j = 0; j < n; ++j) {
+			vreader.Goto(base + j);
+			ReadVertexInputs(vreader, state, out[base + j], pos[j], normal[j]);
+		}
+		// Keep unused lanes valid, just to avoid slow paths on garbage.
+		for (int j = n; j < 4; ++j)
+			pos[j] = pos[0];
+
+		Vec4f px(pos[0].x, pos[1].x, pos[2].x, pos[3].x);
+		Vec4f py(pos[0].y, pos[1].y, pos[2].y, pos[3].y);
+		Vec4f pz(pos[0].z, pos[1].z, pos[2].z, pos[3].z);
+		if (toWorld) {
+			Vec4f wx = MatrixRowLanes(px, py, pz, w[0], w[3], w[6], w[9]);
+			Vec4f wy = MatrixRowLanes(px, py, pz, w[1], w[4], w[7], w[10]);
+			Vec4f wz = MatrixRowLanes(px, py, pz, w[2], w[5], w[8], w[11]);
+			for (int j = 0; j < n; ++j)
+				worldpos[j] = WorldCoords(wx[j], wy[j], wz[j]);
+			px = wx;
+			py = wy;
+			pz = wz;
+		}
+
+		Vec4f cx = MatrixRowLanes(px, py, pz, m[0], m[4], m[8], m[12]);
+		Vec4f cy = MatrixRowLanes(px, py, pz, m[1], m[5], m[9], m[13]);
+		Vec4f cz = MatrixRowLanes(px, py, pz, m[2], m[6], m[10], m[14]);
+		Vec4f cw = MatrixRowLanes(px, py, pz, m[3], m[7], m[11], m[15]);
+
+		Vec4f sx = DivideLanes(cx * Vec4f::AssignToAll(state.screenScale.x), cw) + Vec4f::AssignToAll(state.screenAdd.x);
+		Vec4f sy = DivideLanes(cy * Vec4f::AssignToAll(state.screenScale.y), cw) + Vec4f::AssignToAll(state.screenAdd.y);
+		Vec4f sz = DivideLanes(cz * Vec4f::AssignToAll(state.screenScale.z), cw) + Vec4f::AssignToAll(state.screenAdd.z);
+
+		for (int j = 0; j < n; ++j) {
+			ClipVertexData &vertex = out[base + j];
+			vertex.clippos = ClipCoords(cx[j], cy[j], cz[j], cw[j]);
+			FinishTransformedVertex(vertex, pos[j], normal[j], worldpos[j], Vec3f(sx[j], sy[j], sz[j]), state);
+		}
+	}
+}
+
 void TransformUnit::SetDirty(SoftDirty flags) {
 	binner_->SetDirty(flags);
 }
@@ -492,6 +578,9 @@ class SoftwareVertexReader {
 		// If we're only using a subset of verts, it's better to decode with random access (usually.)
 		// However, if we're reusing a lot of verts, we should read and cache them.
 		useCache_ = useIndices_ && vertex_count > (upperBound_ - lowerBound_ + 1);
+		// Without indices every vert is read once anyway, so transforming them in batches is a win.
+		if (!useIndices_ && !vreader_.isThrough() && vertex_count >= 4)
+			useCache_ = true;
 		if (useCache_ && (int)cached_.size() < upperBound_ - lowerBound_ + 1)
 			cached_.resize(std::max(128, upperBound_ - lowerBound_ + 1));
 	}
@@ -508,10 +597,7 @@ class SoftwareVertexReader {
 		if (!useCache_)
 			return;
 
-		for (int i = 0; i < upperBound_ - lowerBound_ + 1; ++i) {
-			vreader_.Goto(i);
-			cached_[i] = transform_.ReadVertex(vreader_, transformState_);
-		}
+		transform_.ReadVertices(vreader_, transformState_, upperBound_ - lowerBound_ + 1, cached_.data());
 	}
 
 	inline ClipVertexData Read(int vtx) {
@@ -520,6 +606,8 @@ class SoftwareVertexReader {
 				return cached_[conv_(vtx) - lowerBound_];
 			}
 			vreader_.Goto(conv_(vtx) - lowerBound_);
+		} else if (useCache_) {
+			return cached_[vtx];
 		} else {
 			vreader_.Goto(vtx);
 		}
@@ -903,10 +991,14 @@ void TransformUnit::FlushIfOverlap(GPUCommon *common, const char *reason, bool m
 	if (!hasDraws_)
 		return;
 
-	if (binner_->HasPendingWrite(addr, stride, w, h))
-		Flush(common, reason);
-	if (modifying && binner_->HasPendingRead(addr, stride, w, h))
-		Flush(common, reason);
+	// Only wait for the draws that touch the range, later ones can keep drawing.
+	uint32_t seq = binner_->PendingWriteSeq(addr, stride, w, h);
+	if (modifying)
+		seq = std::max(seq, binner_->PendingReadSeq(addr, stride, w, h));
+	if (binner_->FlushPending(reason, seq)) {
+		common->NotifyFlush();
+		hasDraws_ = false;
+	}
 }
 
 void TransformUnit::NotifyClutUpdate(const void *src) {
@@ -150,6 +150,8 @@ class TransformUnit {
 
 private:
 	ClipVertexData ReadVertex(const VertexReader &vreader, const TransformState &state);
+	// Reads and transforms the first count verts in order.
+	void ReadVertices(VertexReader &vreader, const TransformState &state, int count, ClipVertexData *out);
 	void SendTriangle(CullType cullType, const ClipVertexData *verts, int provoking = 2);
 
 	u8 *decoded_ = nullptr;
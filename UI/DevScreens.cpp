@@ -417,6 +417,7 @@ static const JitDisableFlag jitDisableFlags[] = {
 	{ MIPSComp::JitDisable::LSU_UNALIGNED, "LSU_UNALIGNED" },
 	{ MIPSComp::JitDisable::LSU_FPU, "LSU_FPU" },
 	{ MIPSComp::JitDisable::LSU_VFPU, "LSU_VFPU" },
+	{ MIPSComp::JitDisable::LOOP_UNROLL, "LOOP_UNROLL" },
 	{ MIPSComp::JitDisable::SIMD, "SIMD" },
 	{ MIPSComp::JitDisable::BLOCKLINK, "Block Linking" },
 	{ MIPSComp::JitDisable::POINTERIFY, "Pointerify" },
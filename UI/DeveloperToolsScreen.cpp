@@ -17,6 +17,7 @@
 
 #include <string>
 
+#include "Common/CPUDetect.h"
 #include "Common/UI/View.h"
 #include "Common/UI/ViewGroup.h"
 #include "Common/System/OSD.h"
@@ -150,6 +151,12 @@ void DeveloperToolsScreen::CreateGeneralTab(UI::LinearLayout *list) {
 #endif
 
 	list->Add(new Choice(dev->T("JIT debug tools")))->OnClick.Handle(this, &DeveloperToolsScreen::OnJitDebugTools);
+#if PPSSPP_ARCH(AMD64)
+	if (cpu_info.bFMA3) {
+		// Only used by "JIT using IR", and changes rounding slightly compared to the interpreter.
+		list->Add(new CheckBox(&g_Config.bJitFuseFMA, dev->T("Fuse vector multiply-add (FMA3)")))->OnClick.Handle(this, &DeveloperToolsScreen::OnJitAffectingSetting);
+	}
+#endif
 	list->Add(new CheckBox(&g_Config.bShowDeveloperMenu, dev->T("Show Developer Menu")));
 
 	AddOverlayList(list, screenManager());
@@ -3,6 +3,8 @@
 #include "UI/JitCompareScreen.h"
 
 #include "Core/MemMap.h"
+#include "Core/System.h"
+#include "Core/MIPS/MIPSAnalyst.h"
 #include "Core/MIPS/MIPSTables.h"
 #include "Core/MIPS/JitCommon/JitBlockCache.h"
 #include "Core/MIPS/JitCommon/JitCommon.h"
@@ -142,6 +144,13 @@ void JitCompareScreen::CreateViews() {
 	statsView_->SetVisibility(V_GONE);
 
 	LinearLayout *statsTopBar = statsView_->Add(new LinearLayout(ORIENT_HORIZONTAL, new LinearLayoutParams(FILL_PARENT, WRAP_CONTENT)));
+	statsTopBar->Add(new Button(dev->T("Save hot functions")))->OnClick.Add([](UI::EventParams &e) {
+		std::lock_guard<std::recursive_mutex> guard(MIPSComp::jitLock);
+		if (MIPSComp::jit) {
+			MIPSAnalyst::StoreHotFunctionReport(GetSysDirectory(DIRECTORY_SYSTEM) / "hotfuncs.txt", MIPSComp::jit->GetBlockCacheDebugInterface());
+		}
+		return UI::EVENT_DONE;
+	});
 	ScrollView *statsScroll = statsView_->Add(new ScrollView(ORIENT_VERTICAL, new LinearLayoutParams(1.0f)));
 	statsContainer_ = statsScroll->Add(new LinearLayout(ORIENT_VERTICAL, new LinearLayoutParams(FILL_PARENT, WRAP_CONTENT)));
 
@@ -359,6 +368,17 @@ void JitCompareScreen::UpdateDisasm() {
 			100.0 * bcStats.maxBloat, bcStats.maxBloatBlock);
 
 		statsContainer_->Add(new TextView(stats));
+
+		if (blockCacheDebug->SupportsProfiling()) {
+			statsContainer_->Add(new ItemHeader("Hot functions"));
+			for (const MIPSAnalyst::HotFunction &f : MIPSAnalyst::FindHotFunctions(blockCacheDebug, 20)) {
+				char temp[256];
+				snprintf(temp, sizeof(temp), "%0.2f%%  %08x %s  (%lld calls)%s",
+					sumTotalNanos_ != 0 ? 100.0 * (double)f.totalNanos / (double)sumTotalNanos_ : 0.0,
+					f.start, f.name.c_str(), (long long)f.calls, f.hasReplacement ? "  [replaced]" : "");
+				statsContainer_->Add(new TextView(temp));
+			}
+		}
 	}
 }
 
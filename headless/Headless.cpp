@@ -16,6 +16,7 @@
 #include <algorithm>
 
 #include "Common/Profiler/Profiler.h"
+#include "Common/Profiler/TraceRecorder.h"
 #include "Common/System/NativeApp.h"
 #include "Common/System/Request.h"
 #include "Common/System/System.h"
@@ -39,6 +40,8 @@
 #include "Core/ConfigValues.h"
 #include "Core/Core.h"
 #include "Core/CoreTiming.h"
+#include "Core/Debugger/SamplingProfiler.h"
+#include "Core/FrameTiming.h"
 #include "Core/System.h"
 #include "Core/WebServer.h"
 #include "Core/HLE/sceUtility.h"
@@ -49,6 +52,7 @@
 
 #include "Compare.h"
 #include "HeadlessHost.h"
+#include "ParallelRunner.h"
 #if defined(_WIN32)
 #include "WindowsHeadlessHost.h"
 #elif defined(SDL)
@@ -139,10 +143,18 @@ int printUsage(const char *progname, const char *reason)
 	fprintf(stderr, "  --debugger=PORT       enable websocket debugger and break at start\n");
 
 	fprintf(stderr, "  --graphics=BACKEND    use a different gpu backend\n");
-	fprintf(stderr, "                        options: gles, software, directx9, etc.\n");
+	fprintf(stderr, "                        options: gles, software, directx9, null, etc.\n");
 	fprintf(stderr, "  --screenshot=FILE     compare against a screenshot\n");
 	fprintf(stderr, "  --max-mse=NUMBER      maximum allowed MSE error for screenshot\n");
 	fprintf(stderr, "  --timeout=SECONDS     abort test it if takes longer than SECONDS\n");
+	fprintf(stderr, "  --trace=FILE          record syscall/jit/gpu spans to a Chrome trace JSON file\n");
+	fprintf(stderr, "  --profile=FILE        sample guest call stacks, write folded stacks for flamegraphs\n");
+	fprintf(stderr, "  --profile-interval=US emulated microseconds between profiler samples (default 1000)\n");
+	fprintf(stderr, "  --frame-times=FILE    write per-frame cpu/ge/wait times to a CSV, print percentiles\n");
+	fprintf(stderr, "  --shared-cache        share the cached ISO with other instances on this host\n");
+	fprintf(stderr, "  --jobs=N              run N tests at once, each in its own process\n");
+	fprintf(stderr, "  --junit=FILE          write results and timings as JUnit XML (implies --jobs)\n");
+	fprintf(stderr, "  --json=FILE           write results and timings as JSON (implies --jobs)\n");
 
 	fprintf(stderr, "  -v, --verbose         show the full passed/failed result\n");
 	fprintf(stderr, "  -i                    use the interpreter\n");
@@ -159,6 +171,8 @@ static HeadlessHost *getHost(GPUCore gpuCore) {
 	switch (gpuCore) {
 	case GPUCORE_SOFTWARE:
 		return new HeadlessHost();
+	case GPUCORE_NULL:
+		return new NullHeadlessHost();
 #ifdef HEADLESSHOST_CLASS
 	default:
 		return new HEADLESSHOST_CLASS();
@@ -361,6 +375,7 @@ int main(int argc, const char* argv[])
 	CPUCore cpuCore = CPUCore::JIT;
 	int debuggerPort = -1;
 	bool oldAtrac = false;
+	bool sharedCache = false;
 	bool outputDebugStringLog = false;
 
 	std::vector<std::string> testFilenames;
@@ -368,6 +383,13 @@ int main(int argc, const char* argv[])
 	const char *mountIso = nullptr;
 	const char *mountRoot = nullptr;
 	const char *screenshotFilename = nullptr;
+	const char *traceFilename = nullptr;
+	const char *profileFilename = nullptr;
+	int profileInterval = 1000;
+	const char *frameTimesFilename = nullptr;
+	int jobs = 0;
+	const char *junitFilename = nullptr;
+	const char *jsonFilename = nullptr;
 
 	for (int i = 1; i < argc; i++)
 	{
@@ -403,14 +425,24 @@ int main(int argc, const char* argv[])
 			testOptions.verbose = true;
 		else if (!strcmp(argv[i], "--old-atrac"))
 			oldAtrac = true;
+		else if (!strcmp(argv[i], "--shared-cache"))
+			sharedCache = true;
+		else if (!strncmp(argv[i], "--jobs=", strlen("--jobs=")) && strlen(argv[i]) > strlen("--jobs="))
+			jobs = std::max(1, (int)strtol(argv[i] + strlen("--jobs="), nullptr, 10));
+		else if (!strncmp(argv[i], "--junit=", strlen("--junit=")) && strlen(argv[i]) > strlen("--junit="))
+			junitFilename = argv[i] + strlen("--junit=");
+		else if (!strncmp(argv[i], "--json=", strlen("--json=")) && strlen(argv[i]) > strlen("--json="))
+			jsonFilename = argv[i] + strlen("--json=");
 		else if (!strncmp(argv[i], "--graphics=", strlen("--graphics=")) && strlen(argv[i]) > strlen("--graphics="))
 		{
 			const char *gpuName = argv[i] + strlen("--graphics=");
 			if (!strcasecmp(gpuName, "gles"))
 				gpuCore = GPUCORE_GLES;
-			// There used to be a separate "null" rendering core - just use software.
-			else if (!strcasecmp(gpuName, "software") || !strcasecmp(gpuName, "null"))
+			else if (!strcasecmp(gpuName, "software"))
 				gpuCore = GPUCORE_SOFTWARE;
+			// Processes everything like a hardware backend, but never draws.  Only useful for benchmarking.
+			else if (!strcasecmp(gpuName, "null"))
+				gpuCore = GPUCORE_NULL;
 			else if (!strcasecmp(gpuName, "directx9"))
 				gpuCore = GPUCORE_DIRECTX9;
 			else if (!strcasecmp(gpuName, "directx11"))
@@ -433,6 +465,14 @@ int main(int argc, const char* argv[])
 			testOptions.timeout = strtod(argv[i] + strlen("--timeout="), nullptr);
 		else if (!strncmp(argv[i], "--max-mse=", strlen("--max-mse=")) && strlen(argv[i]) > strlen("--max-mse="))
 			testOptions.maxScreenshotError = strtod(argv[i] + strlen("--max-mse="), nullptr);
+		else if (!strncmp(argv[i], "--trace=", strlen("--trace=")) && strlen(argv[i]) > strlen("--trace="))
+			traceFilename = argv[i] + strlen("--trace=");
+		else if (!strncmp(argv[i], "--profile=", strlen("--profile=")) && strlen(argv[i]) > strlen("--profile="))
+			profileFilename = argv[i] + strlen("--profile=");
+		else if (!strncmp(argv[i], "--profile-interval=", strlen("--profile-interval=")) && strlen(argv[i]) > strlen("--profile-interval="))
+			profileInterval = std::max(1, (int)strtol(argv[i] + strlen("--profile-interval="), nullptr, 10));
+		else if (!strncmp(argv[i], "--frame-times=", strlen("--frame-times=")) && strlen(argv[i]) > strlen("--frame-times="))
+			frameTimesFilename = argv[i] + strlen("--frame-times=");
 		else if (!strncmp(argv[i], "--debugger=", strlen("--debugger=")) && strlen(argv[i]) > strlen("--debugger="))
 			debuggerPort = (int)strtoul(argv[i] + strlen("--debugger="), NULL, 10);
 		else if (!strcmp(argv[i], "--teamcity"))
@@ -466,6 +506,44 @@ int main(int argc, const char* argv[])
 	if (testFilenames.empty())
 		return printUsage(argv[0], argc <= 1 ? NULL : "No executables specified");
 
+	bool isWorker = false;
+	if ((jobs > 0 || junitFilename || jsonFilename) && !ParallelTestsSupported()) {
+		fprintf(stderr, "Test workers aren't supported on this platform, running tests in this process\n");
+	} else if (jobs > 0 || junitFilename || jsonFilename) {
+		if (debuggerPort > 0 || traceFilename || profileFilename || frameTimesFilename)
+			return printUsage(argv[0], "--debugger, --trace, --profile, and --frame-times can't be used with test workers");
+
+		// This has to happen before we start any threads.
+		std::string workerTest;
+		std::vector<ParallelTestResult> results;
+		if (RunParallelTests(testFilenames, std::max(jobs, 1), testOptions.timeout, &results, &workerTest)) {
+			isWorker = true;
+			testFilenames.clear();
+			testFilenames.push_back(workerTest);
+		} else {
+			int failed = 0;
+			for (const ParallelTestResult &result : results) {
+				if (!result.passed)
+					failed++;
+			}
+			if (testOptions.compare) {
+				printf("%d tests passed, %d tests failed.\n", (int)results.size() - failed, failed);
+				if (failed != 0) {
+					printf("Failed tests:\n");
+					for (const ParallelTestResult &result : results) {
+						if (!result.passed)
+							printf("  %s%s\n", result.name.c_str(), result.timedOut ? " (timeout)" : "");
+					}
+				}
+			}
+			if (junitFilename)
+				WriteJUnitReport(Path(std::string(junitFilename)), results);
+			if (jsonFilename)
+				WriteJSONReport(Path(std::string(jsonFilename)), results);
+			return failed != 0 && !teamCityMode ? 1 : 0;
+		}
+	}
+
 	g_Config.bEnableLogging = (fullLog || outputDebugStringLog);
 	g_logManager.Init(&g_Config.bEnableLogging, outputDebugStringLog);
 
@@ -543,6 +621,7 @@ int main(int argc, const char* argv[])
 	g_Config.iReverbVolume = VOLUMEHI_FULL;
 	g_Config.internalDataDirectory.clear();
 	g_Config.bUseOldAtrac = oldAtrac;
+	g_Config.bSharedMemoryCache = sharedCache;
 	g_Config.iForceEnableHLE = 0xFFFFFFFF;  // Run all modules as HLE. We don't have anything to load in this context.
 
 	Path exePath = File::GetExeDirectory();
@@ -604,14 +683,27 @@ int main(int argc, const char* argv[])
 	if (stateToLoad != NULL)
 		SaveState::Load(Path(stateToLoad), -1);
 
+	if (traceFilename) {
+		// Syscalls are only routed through CallSyscall (where they're traced) with debug stats on.
+		PSP_ForceDebugStats(true);
+		TraceRecorder_Start(Path(std::string(traceFilename)));
+	}
+	if (profileFilename)
+		SamplingProfiler_Start(profileInterval);
+	if (frameTimesFilename)
+		g_frameTiming.StartRecording();
+
 	std::vector<std::string> failedTests;
 	std::vector<std::string> passedTests;
+	bool anyFailed = false;
 	for (size_t i = 0; i < testFilenames.size(); ++i)
 	{
 		coreParameter.fileToStart = Path(testFilenames[i]);
 		if (testOptions.compare)
 			printf("%s:\n", coreParameter.fileToStart.c_str());
 		bool passed = RunAutoTest(headlessHost, coreParameter, testOptions);
+		if (!passed)
+			anyFailed = true;
 		if (testOptions.bench) {
 			double st = time_now_d();
 			double deadline = st + testOptions.timeout;
@@ -639,7 +731,8 @@ int main(int argc, const char* argv[])
 		}
 	}
 
-	if (testOptions.compare) {
+	// The parent prints the totals for workers.
+	if (testOptions.compare && !isWorker) {
 		printf("%d tests passed, %d tests failed.\n", (int)passedTests.size(), (int)failedTests.size());
 		if (!failedTests.empty())
 		{
@@ -650,6 +743,26 @@ int main(int argc, const char* argv[])
 		}
 	}
 
+	if (traceFilename) {
+		TraceRecorder_Stop();
+		PSP_ForceDebugStats(false);
+	}
+	if (profileFilename) {
+		SamplingProfiler_Stop();
+		SamplingProfiler_WriteFolded(Path(std::string(profileFilename)));
+	}
+	if (frameTimesFilename) {
+		g_frameTiming.StopRecording();
+		g_frameTiming.WriteCSV(Path(std::string(frameTimesFilename)));
+		printf("Frame times over %d frames (ms):\n", g_frameTiming.RecordedFrames());
+		for (int i = 0; i < (int)FrameTimeMetric::COUNT; ++i) {
+			FrameTimeMetric metric = (FrameTimeMetric)i;
+			printf("  %-12s p50 %7.2f  p95 %7.2f  p99 %7.2f  max %7.2f\n", FrameTimeMetricToString(metric),
+				g_frameTiming.Percentile(metric, 0.50) * 1000.0, g_frameTiming.Percentile(metric, 0.95) * 1000.0,
+				g_frameTiming.Percentile(metric, 0.99) * 1000.0, g_frameTiming.Max(metric) * 1000.0);
+		}
+	}
+
 	if (debuggerPort > 0) {
 		ShutdownWebServer();
 	}
@@ -668,6 +781,9 @@ int main(int argc, const char* argv[])
 
 	g_threadManager.Teardown();
 
+	// The parent decides what to do with failures, even in TeamCity mode.
+	if (isWorker)
+		return anyFailed ? 1 : 0;
 	if (!failedTests.empty() && !teamCityMode)
 		return 1;
 	return 0;
@@ -72,3 +72,10 @@ class HeadlessHost {
 	bool writeFailureScreenshot_ = true;
 	bool writeDebugOutput_ = true;
 };
+
+// Runs the full hardware GPU pipeline against a DrawContext that never draws, for benchmarking.
+class NullHeadlessHost : public HeadlessHost {
+public:
+	bool InitGraphics(std::string *error_message, GraphicsContext **ctx, GPUCore core) override;
+	void ShutdownGraphics() override;
+};
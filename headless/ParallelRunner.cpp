@@ -0,0 +1,263 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#include "ppsspp_config.h"
+
+#if !PPSSPP_PLATFORM(WINDOWS) && !PPSSPP_PLATFORM(ANDROID)
+#define HAVE_FORK_WORKERS 1
+#include <cerrno>
+#include <csignal>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+#include <cmath>
+#include <cstdio>
+
+#include "Common/Data/Format/JSONWriter.h"
+#include "Common/File/FileUtil.h"
+#include "Common/File/Path.h"
+#include "Common/StringUtils.h"
+#include "Common/TimeUtil.h"
+
+#include "Compare.h"
+#include "ParallelRunner.h"
+
+// How long past --timeout a worker gets before it's killed.
+static const double WORKER_KILL_GRACE = 5.0;
+
+bool ParallelTestsSupported() {
+#if HAVE_FORK_WORKERS
+	return true;
+#else
+	return false;
+#endif
+}
+
+#if HAVE_FORK_WORKERS
+struct RunningWorker {
+	pid_t pid;
+	int fd;
+	size_t index;
+	double start;
+	bool killed;
+};
+
+static void FinishWorker(const RunningWorker &worker, std::vector<ParallelTestResult> *results) {
+	int status = 0;
+	while (waitpid(worker.pid, &status, 0) < 0 && errno == EINTR)
+		continue;
+	close(worker.fd);
+
+	ParallelTestResult &result = (*results)[worker.index];
+	result.seconds = time_now_d() - worker.start;
+	result.timedOut = worker.killed;
+	result.passed = !worker.killed && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+	if (worker.killed)
+		result.output += "TIMEOUT (killed)\n";
+	else if (WIFSIGNALED(status))
+		result.output += StringFromFormat("CRASHED (signal %d)\n", WTERMSIG(status));
+
+	// Print each test's output together, so they don't get mixed up.
+	printf("%s", result.output.c_str());
+	fflush(stdout);
+}
+#endif
+
+bool RunParallelTests(const std::vector<std::string> &tests, int jobs, double timeout, std::vector<ParallelTestResult> *results, std::string *workerTest) {
+	results->clear();
+	results->resize(tests.size());
+	for (size_t i = 0; i < tests.size(); ++i) {
+		(*results)[i].filename = tests[i];
+		(*results)[i].name = GetTestName(Path(tests[i]));
+	}
+
+#if HAVE_FORK_WORKERS
+	std::vector<RunningWorker> running;
+	size_t next = 0;
+	while (next < tests.size() || !running.empty()) {
+		while ((int)running.size() < jobs && next < tests.size()) {
+			int fds[2];
+			if (pipe(fds) != 0) {
+				perror("Unable to create pipe for test worker");
+				break;
+			}
+
+			// Otherwise, anything buffered would get printed by both processes.
+			fflush(stdout);
+			fflush(stderr);
+			pid_t pid = fork();
+			if (pid < 0) {
+				perror("Unable to fork test worker");
+				close(fds[0]);
+				close(fds[1]);
+				break;
+			}
+
+			if (pid == 0) {
+				// Worker: send all output to the parent, and don't hold other workers' pipes open.
+				for (const RunningWorker &worker : running)
+					close(worker.fd);
+				close(fds[0]);
+				dup2(fds[1], STDOUT_FILENO);
+				dup2(fds[1], STDERR_FILENO);
+				close(fds[1]);
+				// If we get killed, whatever we printed so far is still useful.
+				setvbuf(stdout, nullptr, _IOLBF, 0);
+				*workerTest = tests[next];
+				return true;
+			}
+
+			close(fds[1]);
+			running.push_back(RunningWorker{ pid, fds[0], next, time_now_d(), false });
+			next++;
+		}
+
+		if (running.empty()) {
+			// Couldn't start anything, so count the rest as failed.
+			for (; next < tests.size(); ++next)
+				(*results)[next].output = "Unable to start test worker\n";
+			break;
+		}
+
+		std::vector<pollfd> pfds;
+		pfds.reserve(running.size());
+		for (const RunningWorker &worker : running)
+			pfds.push_back(pollfd{ worker.fd, POLLIN, 0 });
+		if (poll(pfds.data(), (nfds_t)pfds.size(), 100) < 0 && errno != EINTR) {
+			perror("Unable to wait for test workers");
+			break;
+		}
+
+		double now = time_now_d();
+		for (size_t i = 0; i < running.size(); ) {
+			RunningWorker &worker = running[i];
+			bool done = false;
+			if (pfds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+				char buf[4096];
+				ssize_t len = read(worker.fd, buf, sizeof(buf));
+				if (len > 0)
+					(*results)[worker.index].output.append(buf, len);
+				else if (len == 0 || errno != EINTR)
+					done = true;
+			}
+
+			if (!done && !worker.killed && std::isfinite(timeout) && now > worker.start + timeout + WORKER_KILL_GRACE) {
+				// The pipe closes once it's dead, and then we'll reap it.
+				kill(worker.pid, SIGKILL);
+				worker.killed = true;
+			}
+
+			if (done) {
+				FinishWorker(worker, results);
+				running.erase(running.begin() + i);
+				pfds.erase(pfds.begin() + i);
+			} else {
+				++i;
+			}
+		}
+	}
+	return false;
+#else
+	for (ParallelTestResult &result : *results)
+		result.output = "Test workers not supported on this platform\n";
+	return false;
+#endif
+}
+
+static std::string EscapeXML(const std::string &str) {
+	std::string escaped;
+	escaped.reserve(str.size());
+	for (char c : str) {
+		switch (c) {
+		case '&': escaped += "&amp;"; break;
+		case '<': escaped += "&lt;"; break;
+		case '>': escaped += "&gt;"; break;
+		case '"': escaped += "&quot;"; break;
+		case '\n': case '\r': case '\t': escaped += c; break;
+		default:
+			// Other control characters aren't allowed in XML at all.
+			if ((unsigned char)c >= 0x20)
+				escaped += c;
+			break;
+		}
+	}
+	return escaped;
+}
+
+bool WriteJUnitReport(const Path &filename, const std::vector<ParallelTestResult> &results) {
+	int failures = 0;
+	double total = 0.0;
+	for (const ParallelTestResult &result : results) {
+		if (!result.passed)
+			failures++;
+		total += result.seconds;
+	}
+
+	std::string xml = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+	xml += StringFromFormat("<testsuites tests=\"%d\" failures=\"%d\" time=\"%.3f\">\n", (int)results.size(), failures, total);
+	xml += StringFromFormat("  <testsuite name=\"pspautotests\" tests=\"%d\" failures=\"%d\" time=\"%.3f\">\n", (int)results.size(), failures, total);
+	for (const ParallelTestResult &result : results) {
+		xml += StringFromFormat("    <testcase name=\"%s\" file=\"%s\" time=\"%.3f\">\n", EscapeXML(result.name).c_str(), EscapeXML(result.filename).c_str(), result.seconds);
+		if (!result.passed)
+			xml += StringFromFormat("      <failure message=\"%s\"/>\n", result.timedOut ? "Test timeout" : "Test failed");
+		xml += "      <system-out>" + EscapeXML(result.output) + "</system-out>\n";
+		xml += "    </testcase>\n";
+	}
+	xml += "  </testsuite>\n";
+	xml += "</testsuites>\n";
+
+	if (!File::WriteStringToFile(true, xml, filename)) {
+		fprintf(stderr, "Unable to write JUnit report to %s\n", filename.c_str());
+		return false;
+	}
+	return true;
+}
+
+bool WriteJSONReport(const Path &filename, const std::vector<ParallelTestResult> &results) {
+	int passed = 0;
+	for (const ParallelTestResult &result : results) {
+		if (result.passed)
+			passed++;
+	}
+
+	json::JsonWriter writer(json::JsonWriter::PRETTY);
+	writer.begin();
+	writer.writeInt("passed", passed);
+	writer.writeInt("failed", (int)results.size() - passed);
+	writer.pushArray("tests");
+	for (const ParallelTestResult &result : results) {
+		writer.pushDict();
+		writer.writeString("name", result.name);
+		writer.writeString("file", result.filename);
+		writer.writeBool("passed", result.passed);
+		writer.writeBool("timedOut", result.timedOut);
+		writer.writeFloat("seconds", result.seconds);
+		writer.writeString("output", result.output);
+		writer.pop();
+	}
+	writer.pop();
+	writer.end();
+
+	if (!File::WriteStringToFile(true, writer.str(), filename)) {
+		fprintf(stderr, "Unable to write JSON report to %s\n", filename.c_str());
+		return false;
+	}
+	return true;
+}
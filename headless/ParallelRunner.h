@@ -0,0 +1,48 @@
+// Copyright (c) 2026- PPSSPP Project.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, version 2.0 or later versions.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License 2.0 for more details.
+
+// A copy of the GPL 2.0 should have been included with the program.
+// If not, see http://www.gnu.org/licenses/
+
+// Official git repository and contact information can be found at
+// https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+class Path;
+
+struct ParallelTestResult {
+	std::string filename;
+	std::string name;
+	std::string output;
+	double seconds = 0.0;
+	bool passed = false;
+	bool timedOut = false;
+};
+
+bool ParallelTestsSupported();
+
+// Forks a worker process per test, up to jobs at a time, so a crash or hang only takes out one test.
+// This must be called before any threads are started.
+//
+// In a worker, returns true with *workerTest set, and the caller should run just that test, then exit
+// with a non-zero code if it failed.  In the parent, prints each test's output as it finishes,
+// fills results (in the order of tests), and returns false.
+//
+// Workers are killed if they run past timeout plus a grace period, in case they hang outside the
+// emulator loop where --timeout is checked.
+bool RunParallelTests(const std::vector<std::string> &tests, int jobs, double timeout, std::vector<ParallelTestResult> *results, std::string *workerTest);
+
+bool WriteJUnitReport(const Path &filename, const std::vector<ParallelTestResult> &results);
+bool WriteJSONReport(const Path &filename, const std::vector<ParallelTestResult> &results);
@@ -16,9 +16,12 @@
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 
 #include "ppsspp_config.h"
 
+#include "Common/CPUDetect.h"
 #include "Common/System/NativeApp.h"
 #include "Common/System/System.h"
 #include "Common/TimeUtil.h"
@@ -225,3 +228,69 @@ bool TestJit() {
 
 	return jit_speed >= interp_speed;
 }
+
+static void RunVmmulOnce(float result[16]) {
+	// Same sources each time, vmmul only writes M000.
+	for (int i = 0; i < 32; ++i)
+		currentMIPS->v[16 + i] = 1.0f + (float)((i * 37) % 29) / 7.0f;
+
+	currentMIPS->pc = PSP_GetUserMemoryBase();
+	coreState = CORE_RUNNING_CPU;
+	while (coreState == CORE_RUNNING_CPU)
+		mipsr4k.RunLoopUntil(1000000);
+
+	memcpy(result, currentMIPS->v, sizeof(float) * 16);
+	if (MIPSComp::jit)
+		MIPSComp::jit->ClearCache();
+}
+
+// Checks that JitFuseFMA actually fuses the Vec4Scale + Vec4Add the IR expands vmmul into.
+// The fused result rounds once per step, so some lanes should come out slightly different.
+bool TestJitFuseFMA() {
+#if PPSSPP_ARCH(AMD64)
+	if (!cpu_info.bFMA3) {
+		printf("Skipping, no FMA3\n");
+		return true;
+	}
+
+	SetupJitHarness();
+
+	g_Config.bFastMemory = true;
+	u32 *p = (u32 *)Memory::GetPointer(PSP_GetUserMemoryBase());
+	// vmmul.q M000, E100, M200.  A transposed S is what gets expanded into Vec4Scale/Vec4Add.
+	*p++ = 0xF0008080 | (8 << 16) | (0x24 << 8) | 0;
+	*p++ = MIPS_MAKE_SYSCALL("UnitTestFakeSyscalls", "UnitTestTerminator");
+	*p++ = MIPS_MAKE_BREAK(1);
+	*p++ = MIPS_MAKE_JR_RA();
+
+	bool oldFuse = g_Config.bJitFuseFMA;
+	float unfused[16], fused[16];
+	g_Config.bJitFuseFMA = false;
+	mipsr4k.UpdateCore(CPUCore::JIT_IR);
+	RunVmmulOnce(unfused);
+	mipsr4k.UpdateCore(CPUCore::INTERPRETER);
+
+	g_Config.bJitFuseFMA = true;
+	mipsr4k.UpdateCore(CPUCore::JIT_IR);
+	RunVmmulOnce(fused);
+	mipsr4k.UpdateCore(CPUCore::INTERPRETER);
+	g_Config.bJitFuseFMA = oldFuse;
+
+	DestroyJitHarness();
+
+	int differences = 0;
+	for (int i = 0; i < 16; ++i) {
+		if (fabsf(fused[i] - unfused[i]) > fabsf(unfused[i]) * 1e-6f) {
+			printf("Lane %d: fused %f vs unfused %f\n", i, fused[i], unfused[i]);
+			return false;
+		}
+		if (memcmp(&fused[i], &unfused[i], sizeof(float)) != 0)
+			differences++;
+	}
+	if (differences == 0) {
+		printf("Fused result identical to unfused, the FMA path didn't run\n");
+		return false;
+	}
+#endif
+	return true;
+}
@@ -166,6 +166,82 @@ static const IRVerification tests[] = {
 		},
 		{ &PropagateConstants },
 	},
+	{
+		"InterpreterSuperinstructions",
+		{
+			{ IROp::ShlImm, { MIPS_REG_T0 }, MIPS_REG_A0, 2 },
+			{ IROp::Add, { MIPS_REG_T0 }, MIPS_REG_A1, MIPS_REG_T0 },
+			{ IROp::ShrImm, { MIPS_REG_T1 }, MIPS_REG_A2, 8 },
+			{ IROp::AndConst, { MIPS_REG_T1 }, MIPS_REG_T1, 0, 0xFF },
+			// Different dest, can't fuse.
+			{ IROp::ShlImm, { MIPS_REG_T2 }, MIPS_REG_A0, 2 },
+			{ IROp::Add, { MIPS_REG_T3 }, MIPS_REG_T2, MIPS_REG_A1 },
+		},
+		{
+			{ IROp::Downcount, { 0 }, 0, 0, 0 },
+			{ IROp::OptShlImmAdd, { MIPS_REG_T0 }, MIPS_REG_A0, MIPS_REG_A1, 2 },
+			{ IROp::OptShrImmAndConst, { MIPS_REG_T1 }, MIPS_REG_A2, 8, 0xFF },
+			{ IROp::ShlImm, { MIPS_REG_T2 }, MIPS_REG_A0, 2 },
+			{ IROp::Add, { MIPS_REG_T3 }, MIPS_REG_T2, MIPS_REG_A1 },
+		},
+		{ &OptimizeForInterpreter },
+	},
+	{
+		"ReduceRedundantLoads",
+		{
+			{ IROp::Load32, { MIPS_REG_V0 }, MIPS_REG_A0, 0, 0x10 },
+			{ IROp::Store32, { MIPS_REG_V1 }, MIPS_REG_A0, 0, 0x20 },
+			{ IROp::ExitToConstIfEq, { 0 }, MIPS_REG_A1, MIPS_REG_A2, 0x08804000 },
+			{ IROp::Load32, { MIPS_REG_T0 }, MIPS_REG_A0, 0, 0x10 },
+			{ IROp::Load32, { MIPS_REG_V0 }, MIPS_REG_A0, 0, 0x10 },
+			// Overlaps, so the next load has to stay.
+			{ IROp::Store16, { MIPS_REG_V1 }, MIPS_REG_A0, 0, 0x12 },
+			{ IROp::Load32, { MIPS_REG_T1 }, MIPS_REG_A0, 0, 0x10 },
+		},
+		{
+			{ IROp::Load32, { MIPS_REG_V0 }, MIPS_REG_A0, 0, 0x10 },
+			{ IROp::Store32, { MIPS_REG_V1 }, MIPS_REG_A0, 0, 0x20 },
+			{ IROp::ExitToConstIfEq, { 0 }, MIPS_REG_A1, MIPS_REG_A2, 0x08804000 },
+			{ IROp::Mov, { MIPS_REG_T0 }, MIPS_REG_V0 },
+			{ IROp::Store16, { MIPS_REG_V1 }, MIPS_REG_A0, 0, 0x12 },
+			{ IROp::Load32, { MIPS_REG_T1 }, MIPS_REG_A0, 0, 0x10 },
+		},
+		{ &ReduceRedundantLoads },
+	},
+	{
+		"ReduceRedundantLoadsClobber",
+		{
+			{ IROp::Load16, { MIPS_REG_V0 }, MIPS_REG_A0, 0, 0 },
+			{ IROp::AddConst, { MIPS_REG_A0 }, MIPS_REG_A0, 0, 2 },
+			{ IROp::Load16, { MIPS_REG_V1 }, MIPS_REG_A0, 0, 0 },
+			// Different base, might alias.
+			{ IROp::Store32, { MIPS_REG_V1 }, MIPS_REG_SP, 0, 0 },
+			{ IROp::Load16, { MIPS_REG_T0 }, MIPS_REG_A0, 0, 0 },
+		},
+		{
+			{ IROp::Load16, { MIPS_REG_V0 }, MIPS_REG_A0, 0, 0 },
+			{ IROp::AddConst, { MIPS_REG_A0 }, MIPS_REG_A0, 0, 2 },
+			{ IROp::Load16, { MIPS_REG_V1 }, MIPS_REG_A0, 0, 0 },
+			{ IROp::Store32, { MIPS_REG_V1 }, MIPS_REG_SP, 0, 0 },
+			{ IROp::Load16, { MIPS_REG_T0 }, MIPS_REG_A0, 0, 0 },
+		},
+		{ &ReduceRedundantLoads },
+	},
+	{
+		"ReduceRedundantLoadsMirror",
+		{
+			{ IROp::Load32, { MIPS_REG_V0 }, MIPS_REG_ZERO, 0, 0x08804000 },
+			// Uncached mirror of the same word.
+			{ IROp::Store32, { MIPS_REG_V1 }, MIPS_REG_ZERO, 0, 0x48804000 },
+			{ IROp::Load32, { MIPS_REG_T0 }, MIPS_REG_ZERO, 0, 0x08804000 },
+		},
+		{
+			{ IROp::Load32, { MIPS_REG_V0 }, MIPS_REG_ZERO, 0, 0x08804000 },
+			{ IROp::Store32, { MIPS_REG_V1 }, MIPS_REG_ZERO, 0, 0x48804000 },
+			{ IROp::Load32, { MIPS_REG_T0 }, MIPS_REG_ZERO, 0, 0x08804000 },
+		},
+		{ &ReduceRedundantLoads },
+	},
 };
 
 bool TestIRPassSimplify() {
@@ -29,6 +29,7 @@ bool TestRiscVEmitter() {
 	cpu_info.RiscV_D = true;
 	cpu_info.RiscV_F = true;
 	cpu_info.RiscV_M = true;
+	cpu_info.RiscV_V = true;
 
 	u32 code[1024];
 	RiscVEmitter emitter((u8 *)code, (u8 *)code);
@@ -70,5 +71,42 @@ bool TestRiscVEmitter() {
 		EXPECT_EQ_HEX(code[i], expected[i]);
 	}
 
+	// These are used by the Vec4 ops in the jit.
+	emitter.SetCodePointer((u8 *)code, (u8 *)code);
+	emitter.VSETIVLI(X0, 4, VType(32, VLMul::M1, VTail::A, VMask::A));
+	emitter.VLE_V(32, V1, X11);
+	emitter.VSE_V(32, V1, X11);
+	emitter.VFADD_VV(V3, V1, V2);
+	emitter.VFMUL_VF(V3, V1, F10);
+	emitter.VFREDOSUM_VS(V3, V1, V2);
+	emitter.VSLIDEDOWN_VI(V3, V1, 2);
+	emitter.VFMACC_VV(V3, V1, V2);
+	emitter.VFMV_F_S(F10, V3);
+	emitter.VMV_S_X(V2, X10);
+	emitter.VFMV_S_F(V2, F10);
+	emitter.VRGATHEREI16_VV(V1, V0, V2);
+
+	static constexpr uint32_t expectedVector[] = {
+		0xcd027057,
+		0x0205e087,
+		0x0205e0a7,
+		0x021111d7,
+		0x921551d7,
+		0x0e1111d7,
+		0x3e1131d7,
+		0xb22091d7,
+		0x42301557,
+		0x42056157,
+		0x42055157,
+		0x3a0100d7,
+	};
+
+	len = (u32 *)emitter.GetWritableCodePtr() - code;
+	EXPECT_EQ_INT(len, ARRAY_SIZE(expectedVector));
+
+	for (ptrdiff_t i = 0; i < len; ++i) {
+		EXPECT_EQ_HEX(code[i], expectedVector[i]);
+	}
+
 	return true;
 }
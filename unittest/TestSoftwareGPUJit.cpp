@@ -15,11 +15,16 @@
 // Official git repository and contact information can be found at
 // https://github.com/hrydgard/ppsspp and http://www.ppsspp.org/.
 
+#include <algorithm>
+#include <vector>
+
+#include "Common/CPUDetect.h"
 #include "Common/Data/Random/Rng.h"
 #include "Common/StringUtils.h"
 #include "Core/Config.h"
 #include "GPU/Software/BinManager.h"
 #include "GPU/Software/DrawPixel.h"
+#include "GPU/Software/Rasterizer.h"
 #include "GPU/Software/Sampler.h"
 #include "GPU/Software/SoftGpu.h"
 
@@ -171,6 +176,139 @@ static bool TestPixelJit() {
 #endif
 }
 
+// Drawing x wraps at 1024, so coverage is counted per wrapped column.
+static constexpr int COVERAGE_W = 1024;
+static constexpr int COVERAGE_H = 512;
+static std::vector<uint8_t> *coverageHits;
+// Only these rows are cleared and compared, anything drawn outside them is wrong anyway.
+static int coverageRowStart, coverageRowEnd;
+static int coverageOutside;
+
+static void SOFTRAST_CALL CountCoveragePixel(int x, int y, int z, int fog, Rasterizer::Vec4IntArg color_in, const PixelFuncID &pixelID) {
+	if (y >= coverageRowStart && y < coverageRowEnd)
+		(*coverageHits)[y * COVERAGE_W + (x & (COVERAGE_W - 1))]++;
+	else
+		coverageOutside++;
+}
+
+// Reference top-left rule, same as the rasterizer's.
+static bool IsRightSideOrFlatBottom(const ScreenCoords &vertex, const ScreenCoords &line1, const ScreenCoords &line2) {
+	if (line1.y == line2.y)
+		return vertex.y < line1.y;
+	return vertex.x < line1.x + (line2.x - line1.x) * (vertex.y - line1.y) / (line2.y - line1.y);
+}
+
+// Plain per-quad edge test over the whole range, without any block classification.
+static void ReferenceCoverage(const VertexData &v0, const VertexData &v1, const VertexData &v2, const BinCoords &range, std::vector<uint8_t> &hits) {
+	const ScreenCoords *verts[3] = { &v0.screenpos, &v1.screenpos, &v2.screenpos };
+	int64_t xf[3], yf[3], c[3], bias[3];
+	for (int e = 0; e < 3; ++e) {
+		const ScreenCoords &a = *verts[(e + 1) % 3];
+		const ScreenCoords &b = *verts[(e + 2) % 3];
+		xf[e] = a.y - b.y;
+		yf[e] = b.x - a.x;
+		c[e] = (int64_t)b.y * a.x - (int64_t)b.x * a.y;
+		bias[e] = IsRightSideOrFlatBottom(*verts[e], a, b) ? -1 : 0;
+	}
+
+	static constexpr int centerOff = SCREEN_SCALE_FACTOR / 2 - 1;
+	for (int quadY = range.y1; quadY <= range.y2; quadY += SCREEN_SCALE_FACTOR * 2) {
+		for (int quadX = range.x1; quadX <= range.x2; quadX += SCREEN_SCALE_FACTOR * 2) {
+			for (int i = 0; i < 4; ++i) {
+				int x = quadX + (i & 1) * SCREEN_SCALE_FACTOR;
+				int y = quadY + (i / 2) * SCREEN_SCALE_FACTOR;
+				if (x > range.x2 || y > range.y2)
+					continue;
+				bool inside = true;
+				for (int e = 0; e < 3; ++e)
+					inside = inside && xf[e] * (x + centerOff) + yf[e] * (y + centerOff) + c[e] + bias[e] >= 0;
+				if (inside) {
+					int drawY = y / SCREEN_SCALE_FACTOR;
+					int drawX = quadX / SCREEN_SCALE_FACTOR + (i & 1);
+					hits[drawY * COVERAGE_W + (drawX & (COVERAGE_W - 1))]++;
+				}
+			}
+		}
+	}
+}
+
+// DrawTriangleSlice skips whole 8x8 blocks and only scissors blocks fully inside, check that against per-quad tests.
+static bool TestTriangleCoverage() {
+	using namespace Rasterizer;
+
+	RasterizerState state{};
+	state.pixelID.clearMode = true;
+	state.enableTextures = false;
+	state.shadeGouraud = false;
+	state.drawPixel = &CountCoveragePixel;
+
+	std::vector<uint8_t> expected(COVERAGE_W * COVERAGE_H);
+	std::vector<uint8_t> actual(COVERAGE_W * COVERAGE_H);
+	coverageHits = &actual;
+
+	// Runs the generic path too, when SSE4 is available.
+	const bool hadSSE4 = cpu_info.bSSE4_1;
+	GMRng rng;
+	int failures = 0;
+	for (int pass = 0; pass < (hadSSE4 ? 2 : 1); ++pass) {
+		cpu_info.bSSE4_1 = hadSSE4 && pass == 0;
+		for (int n = 0; n < 2000 && failures < 5; ++n) {
+			// Every fourth range is wider than the block classification handles (1032 pixels.)
+			const bool wide = (n & 3) == 3;
+			const int maxW = wide ? 1250 * SCREEN_SCALE_FACTOR : 80 * SCREEN_SCALE_FACTOR;
+			const int extent = wide ? 4000 : 2400;
+			auto coord = [&](int range) {
+				return (int)(rng.R32() % (uint32_t)range);
+			};
+
+			BinCoords range;
+			range.x1 = coord(extent / SCREEN_SCALE_FACTOR) * SCREEN_SCALE_FACTOR;
+			range.y1 = coord(extent / SCREEN_SCALE_FACTOR) * SCREEN_SCALE_FACTOR;
+			// Arbitrary ends, so the last blocks and quads are often partial.
+			range.x2 = range.x1 + (wide ? 1040 * SCREEN_SCALE_FACTOR : 0) + coord(maxW);
+			range.y2 = range.y1 + coord(wide ? 40 * SCREEN_SCALE_FACTOR : maxW);
+
+			VertexData v[3]{};
+			for (int i = 0; i < 3; ++i) {
+				// Sometimes snapped to whole pixels, to hit the edge tie rules.
+				int snap = (n & 4) ? ~(SCREEN_SCALE_FACTOR - 1) : ~0;
+				v[i].screenpos = ScreenCoords((range.x1 - 200 + coord(range.x2 - range.x1 + 400)) & snap, (range.y1 - 200 + coord(range.y2 - range.y1 + 400)) & snap, 1000);
+				v[i].screenpos.x = std::max(v[i].screenpos.x, 0);
+				v[i].screenpos.y = std::max(v[i].screenpos.y, 0);
+			}
+			// Only counter-clockwise triangles draw anything.
+			int64_t area = (int64_t)(v[1].screenpos.x - v[0].screenpos.x) * (v[2].screenpos.y - v[0].screenpos.y) - (int64_t)(v[2].screenpos.x - v[0].screenpos.x) * (v[1].screenpos.y - v[0].screenpos.y);
+			if (area < 0)
+				std::swap(v[1], v[2]);
+
+			coverageRowStart = range.y1 / SCREEN_SCALE_FACTOR;
+			coverageRowEnd = range.y2 / SCREEN_SCALE_FACTOR + 1;
+			coverageOutside = 0;
+			auto rowsBegin = [&](std::vector<uint8_t> &hits) { return hits.begin() + coverageRowStart * COVERAGE_W; };
+			auto rowsEnd = [&](std::vector<uint8_t> &hits) { return hits.begin() + coverageRowEnd * COVERAGE_W; };
+			std::fill(rowsBegin(expected), rowsEnd(expected), 0);
+			std::fill(rowsBegin(actual), rowsEnd(actual), 0);
+			ReferenceCoverage(v[0], v[1], v[2], range, expected);
+			DrawTriangle(v[0], v[1], v[2], range, state);
+
+			if (coverageOutside != 0 || !std::equal(rowsBegin(expected), rowsEnd(expected), rowsBegin(actual))) {
+				printf("Coverage mismatch (%s): (%d,%d) (%d,%d) (%d,%d) in %d,%d - %d,%d\n", cpu_info.bSSE4_1 ? "SSE4" : "generic",
+					v[0].screenpos.x, v[0].screenpos.y, v[1].screenpos.x, v[1].screenpos.y, v[2].screenpos.x, v[2].screenpos.y,
+					range.x1, range.y1, range.x2, range.y2);
+				failures++;
+			}
+		}
+	}
+	cpu_info.bSSE4_1 = hadSSE4;
+	coverageHits = nullptr;
+
+	return failures == 0;
+}
+
+bool TestSoftwareGPURasterizer() {
+	return TestTriangleCoverage();
+}
+
 bool TestSoftwareGPUJit() {
 	g_Config.bSoftwareRenderingJit = true;
 	ResetHitAnyAsserts();
@@ -38,6 +38,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
+#include <functional>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -64,9 +65,12 @@
 
 #include "Common/Input/InputState.h"
 #include "Common/Math/math_util.h"
+#include "Common/Math/Statistics.h"
+#include "Common/MemoryUtil.h"
 #include "Common/Render/DrawBuffer.h"
 #include "Common/System/NativeApp.h"
 #include "Common/System/System.h"
+#include "Common/Thread/ThreadManager.h"
 #include "Common/Thread/ThreadUtil.h"
 #include "Common/Data/Format/IniFile.h"
 #include "Common/TimeUtil.h"
@@ -77,6 +81,7 @@
 #include "Common/Log.h"
 #include "Common/StringUtils.h"
 #include "Core/Config.h"
+#include "Core/HLE/ThreadQueueList.h"
 #include "Common/Data/Convert/ColorConv.h"
 #include "Common/File/VFS/VFS.h"
 #include "Common/File/VFS/DirectoryReader.h"
@@ -86,6 +91,8 @@
 #include "Core/MIPS/MIPSVFPUUtils.h"
 #include "GPU/Common/TextureDecoder.h"
 #include "GPU/Common/GPUStateUtils.h"
+#include "GPU/Common/DepthRaster.h"
+#include "GPU/Common/FramebufferManagerCommon.h"
 
 #include "Common/File/AndroidContentURI.h"
 
@@ -927,6 +934,182 @@ static bool TestDepthMath() {
 	return true;
 }
 
+// Shared by the test and the benchmark.  When benchmarking, times both paths instead of comparing them.
+static bool RunDepthRaster(bool benchmark) {
+	// Something like an occlusion pass: lots of overlapping mid-size triangles, a few with their own scissor.
+	const int stride = 512;
+	const int height = 272;
+	const int numDraws = 24;
+	const int trisPerDraw = 900;
+
+	std::vector<float> transformed(numDraws * trisPerDraw * 3 * 4);
+	std::vector<uint16_t> indices(numDraws * trisPerDraw * 3);
+	DepthDraw draws[numDraws]{};
+	uint32_t seed = 0x12345678;
+	auto rand = [&](int range) {
+		seed = seed * 1103515245 + 12345;
+		return (int)((seed >> 8) % (uint32_t)range);
+	};
+	for (int d = 0; d < numDraws; d++) {
+		DepthDraw &draw = draws[d];
+		draw.depthStride = stride;
+		draw.prim = GE_PRIM_TRIANGLES;
+		draw.compareMode = d % 5 == 4 ? ZCompareMode::Less : ZCompareMode::Greater;
+		draw.cullEnabled = d % 3 != 0;
+		draw.cullMode = GE_CULL_CCW;
+		draw.scissor = d % 4 == 3 ? DepthScissor{ 37, 20, 301, 250 } : DepthScissor{ 0, 0, 479, 271 };
+		draw.vertexOffset = d * trisPerDraw * 3;
+		draw.indexOffset = d * trisPerDraw * 3;
+		draw.vertexCount = trisPerDraw * 3;
+		for (int i = 0; i < trisPerDraw * 3; i++) {
+			float *v = &transformed[(draw.vertexOffset + i) * 4];
+			int base = i - i % 3;
+			v[0] = (float)(i == base ? rand(520) - 20 : (int)transformed[(draw.vertexOffset + base) * 4] + rand(80) - 40);
+			v[1] = (float)(i == base ? rand(310) - 20 : (int)transformed[(draw.vertexOffset + base) * 4 + 1] + rand(80) - 40);
+			v[2] = (float)(1 + rand(60000));
+			v[3] = 1.0f;
+			indices[draw.indexOffset + i] = (uint16_t)i;
+		}
+	}
+
+	const int components = numDraws * trisPerDraw * 3 * 2 + numDraws * 24;
+	int *tx = (int *)AllocateAlignedMemory(components * sizeof(int), 16);
+	int *ty = (int *)AllocateAlignedMemory(components * sizeof(int), 16);
+	float *tz = (float *)AllocateAlignedMemory(components * sizeof(float), 16);
+	std::vector<uint16_t> reference(stride * height, 0x8000);
+	std::vector<uint16_t> tiled(stride * height, 0x8000);
+
+	std::vector<DepthScreenDraw> screenDraws;
+	int offset = 0;
+	for (int d = 0; d < numDraws; d++) {
+		int count = DepthRasterClipIndexedTriangles(tx + offset, ty + offset, tz + offset, &transformed[draws[d].vertexOffset * 4], &indices[draws[d].indexOffset], draws[d], draws[d].scissor);
+		screenDraws.push_back(DepthScreenDraw{ &draws[d], tiled.data(), offset, count });
+		offset += (count + 3) & ~3;
+	}
+
+	bool initedThreads = false;
+	if (!g_threadManager.IsInitialized()) {
+		g_threadManager.Init(8, 1);
+		initedThreads = true;
+	}
+
+	auto rasterReference = [&]() {
+		for (const DepthScreenDraw &screen : screenDraws) {
+			const DepthDraw &draw = *screen.draw;
+			DepthRasterScreenVerts(reference.data(), stride, tx + screen.offset, ty + screen.offset, tz + screen.offset, screen.count, draw, draw.scissor, false);
+		}
+	};
+	auto rasterTiled = [&]() {
+		DepthRasterScreenDraws(screenDraws.data(), (int)screenDraws.size(), tx, ty, tz, false);
+	};
+
+	if (benchmark) {
+		auto timeFrames = [&](std::vector<uint16_t> &buffer, const std::function<void()> &raster) {
+			int frames = 0;
+			double start = time_now_d();
+			do {
+				std::fill(buffer.begin(), buffer.end(), 0x8000);
+				raster();
+				frames++;
+			} while (time_now_d() - start < 1.0);
+			return (time_now_d() - start) * 1000.0 / frames;
+		};
+		double referenceMs = timeFrames(reference, rasterReference);
+		double tiledMs = timeFrames(tiled, rasterTiled);
+		printf("Depth raster, %d draws of %d triangles: single thread %0.3f ms, tiled %0.3f ms (%0.2fx)\n", numDraws, trisPerDraw, referenceMs, tiledMs, referenceMs / tiledMs);
+	} else {
+		rasterReference();
+		rasterTiled();
+	}
+
+	if (initedThreads)
+		g_threadManager.Teardown();
+	FreeAlignedMemory(tx);
+	FreeAlignedMemory(ty);
+	FreeAlignedMemory(tz);
+
+	int mismatches = 0;
+	for (int i = 0; i < stride * height; i++) {
+		if (reference[i] != tiled[i])
+			mismatches++;
+	}
+	EXPECT_EQ_INT(mismatches, 0);
+	return true;
+}
+
+static bool TestDepthRaster() {
+	return RunDepthRaster(false);
+}
+
+// Not part of "all", run it by name.
+static bool BenchmarkDepthRaster() {
+	return RunDepthRaster(true);
+}
+
+static bool TestFramebufferDirtyRows() {
+	VirtualFramebuffer vfb{};
+	vfb.fb_address = 0x04000000;
+	vfb.fb_stride = 512;
+	vfb.fb_format = GE_FORMAT_8888;
+	vfb.width = 480;
+	vfb.height = 272;
+	const u32 byteStride = 512 * 4;
+
+	// Starts out all dirty, so the first download reads everything.
+	int y = 0, h = 272;
+	EXPECT_TRUE(ClipReadbackToDirtyRows(&vfb, 0, 480, &y, &h));
+	EXPECT_EQ_INT(y, 0);
+	EXPECT_EQ_INT(h, 272);
+	y = 0, h = 272;
+	EXPECT_FALSE(ClipReadbackToDirtyRows(&vfb, 0, 480, &y, &h));
+
+	// Only the drawn rows are read back.
+	SetRowsDirty(&vfb, 100, 150);
+	y = 0, h = 272;
+	EXPECT_TRUE(ClipReadbackToDirtyRows(&vfb, 0, 480, &y, &h));
+	EXPECT_EQ_INT(y, 100);
+	EXPECT_EQ_INT(h, 50);
+
+	// A partial width download doesn't clean anything.
+	SetRowsDirty(&vfb, 10, 20);
+	y = 0, h = 272;
+	EXPECT_TRUE(ClipReadbackToDirtyRows(&vfb, 0, 100, &y, &h));
+	EXPECT_EQ_INT(y, 10);
+	EXPECT_EQ_INT(h, 10);
+	y = 0, h = 272;
+	EXPECT_TRUE(ClipReadbackToDirtyRows(&vfb, 0, 480, &y, &h));
+	y = 0, h = 272;
+	EXPECT_FALSE(ClipReadbackToDirtyRows(&vfb, 0, 480, &y, &h));
+
+	// Writes outside the buffer's memory don't matter.
+	SetRowsDirtyInRange(&vfb, 0x04000000 + 272 * byteStride, byteStride * 4);
+	y = 0, h = 272;
+	EXPECT_FALSE(ClipReadbackToDirtyRows(&vfb, 0, 480, &y, &h));
+
+	// Another buffer downloaded over this one's memory, partially into row 210.
+	SetRowsDirtyInRange(&vfb, 0x04000000 + 200 * byteStride + 16, 10 * byteStride);
+	y = 0, h = 272;
+	EXPECT_TRUE(ClipReadbackToDirtyRows(&vfb, 0, 480, &y, &h));
+	EXPECT_EQ_INT(y, 200);
+	EXPECT_EQ_INT(h, 11);
+
+	// Drawing at a large vertical offset dirties the rows it actually lands on.
+	int y1, y2;
+	ScissorToDrawnRows(0, 271, 0, &y1, &y2);
+	EXPECT_EQ_INT(y1, 0);
+	EXPECT_EQ_INT(y2, 272);
+	ScissorToDrawnRows(10, 99, 272, &y1, &y2);
+	EXPECT_EQ_INT(y1, 282);
+	EXPECT_EQ_INT(y2, 372);
+	vfb.height = 544;
+	SetRowsDirty(&vfb, y1, y2);
+	y = 0, h = 544;
+	EXPECT_TRUE(ClipReadbackToDirtyRows(&vfb, 0, 480, &y, &h));
+	EXPECT_EQ_INT(y, 282);
+	EXPECT_EQ_INT(h, 90);
+	return true;
+}
+
 bool TestInputMapping() {
 	InputMapping mapping;
 	mapping.deviceId = DEVICE_ID_PAD_0;
@@ -1089,6 +1272,36 @@ bool TestCharQueue() {
 	return true;
 }
 
+bool TestThreadQueueList() {
+	ThreadQueueList queue;
+	queue.prepare(0x20);
+	queue.prepare(0x40);
+	queue.prepare(0x7F);
+	EXPECT_EQ_INT(queue.peek_first(), 0);
+
+	queue.push_back(0x40, 1);
+	queue.push_back(0x7F, 2);
+	queue.push_back(0x40, 3);
+	queue.push_front(0x40, 4);
+	EXPECT_EQ_INT(queue.peek_first(), 4);
+	// Nothing better than 0x40 is ready.
+	EXPECT_EQ_INT(queue.pop_first_better(0x40), 0);
+
+	queue.push_back(0x20, 5);
+	EXPECT_EQ_INT(queue.pop_first_better(0x40), 5);
+	EXPECT_TRUE(queue.empty(0x20));
+
+	queue.rotate(0x40);
+	EXPECT_EQ_INT(queue.pop_first(), 1);
+	queue.remove(0x40, 3);
+	EXPECT_EQ_INT(queue.pop_first(), 4);
+	EXPECT_TRUE(queue.empty(0x40));
+	EXPECT_EQ_INT(queue.pop_first_better(0x7F), 0);
+	EXPECT_EQ_INT(queue.pop_first(), 2);
+	EXPECT_EQ_INT(queue.peek_first(), 0);
+	return true;
+}
+
 bool TestBuffer() {
 	Buffer b = Buffer::Void();
 	b.Append("hello");
@@ -1231,6 +1444,30 @@ bool TestVolumeFunc() {
 	return true;
 }
 
+bool TestDurationHistogram() {
+	DurationHistogram hist;
+	EXPECT_EQ_INT(hist.Count(), 0);
+	EXPECT_TRUE(hist.Percentile(0.5) == 0.0);
+
+	// 1ms to 100ms, one each.
+	for (int i = 1; i <= 100; i++)
+		hist.Add(i * 0.001);
+	EXPECT_EQ_INT(hist.Count(), 100);
+	EXPECT_TRUE(fabs(hist.Percentile(0.5) - 0.050) < 0.0002);
+	EXPECT_TRUE(fabs(hist.Percentile(0.99) - 0.099) < 0.0002);
+	EXPECT_TRUE(hist.Percentile(1.0) == hist.Max());
+
+	// Way slow frames go in the last bucket, but the max stays exact.
+	hist.Add(2.5);
+	EXPECT_TRUE(hist.Max() == 2.5);
+	EXPECT_TRUE(hist.Percentile(1.0) == 2.5);
+
+	hist.Reset();
+	EXPECT_EQ_INT(hist.Count(), 0);
+	EXPECT_TRUE(hist.Max() == 0.0);
+	return true;
+}
+
 typedef bool (*TestFunc)();
 struct TestItem {
 	const char *name;
@@ -1245,6 +1482,7 @@ bool TestX64Emitter();
 bool TestRiscVEmitter();
 bool TestShaderGenerators();
 bool TestSoftwareGPUJit();
+bool TestSoftwareGPURasterizer();
 bool TestIRPassSimplify();
 bool TestThreadManager();
 bool TestVFS();
@@ -1270,6 +1508,7 @@ TestItem availableTests[] = {
 	TEST_ITEM(Parsers),
 	TEST_ITEM(IRPassSimplify),
 	TEST_ITEM(Jit),
+	TEST_ITEM(JitFuseFMA),
 	TEST_ITEM(VFPUMatrixTranspose),
 	TEST_ITEM(ParseLBN),
 	TEST_ITEM(QuickTexHash),
@@ -1277,6 +1516,7 @@ TestItem availableTests[] = {
 	TEST_ITEM(MemMap),
 	TEST_ITEM(ShaderGenerators),
 	TEST_ITEM(SoftwareGPUJit),
+	TEST_ITEM(SoftwareGPURasterizer),
 	TEST_ITEM(Path),
 	TEST_ITEM(AndroidContentURI),
 	TEST_ITEM(ThreadManager),
@@ -1285,6 +1525,8 @@ TestItem availableTests[] = {
 	TEST_ITEM(FastVec),
 	TEST_ITEM(SmallDataConvert),
 	TEST_ITEM(DepthMath),
+	TEST_ITEM(DepthRaster),
+	TEST_ITEM(FramebufferDirtyRows),
 	TEST_ITEM(InputMapping),
 	TEST_ITEM(EscapeMenuString),
 	TEST_ITEM(VFS),
@@ -1292,10 +1534,17 @@ TestItem availableTests[] = {
 	TEST_ITEM(IniFile),
 	TEST_ITEM(ColorConv),
 	TEST_ITEM(CharQueue),
+	TEST_ITEM(ThreadQueueList),
 	TEST_ITEM(Buffer),
 	TEST_ITEM(SIMD),
 	TEST_ITEM(CrossSIMD),
 	TEST_ITEM(VolumeFunc),
+	TEST_ITEM(DurationHistogram),
+};
+
+// Slow, and only useful for comparing numbers, so these only run when selected by name.
+TestItem availableBenchmarks[] = {
+	{ "BenchmarkDepthRaster", &BenchmarkDepthRaster },
 };
 
 int main(int argc, const char *argv[]) {
@@ -1324,6 +1573,12 @@ int main(int argc, const char *argv[]) {
 				break;
 			}
 		}
+		for (auto f : availableBenchmarks) {
+			if (!strcasecmp(argv[1], f.name)) {
+				testFunc = f.func;
+				break;
+			}
+		}
 	}
 
 	if (allTests) {
@@ -1351,6 +1606,11 @@ int main(int argc, const char *argv[]) {
 		for (auto f : availableTests) {
 			fprintf(stderr, "  * %s\n", f.name);
 		}
+		fprintf(stderr, "\n");
+		fprintf(stderr, "Available benchmarks (not included in \"all\"):\n");
+		for (auto f : availableBenchmarks) {
+			fprintf(stderr, "  * %s\n", f.name);
+		}
 		return 1;
 	} else {
 		if (!testFunc()) {